@@ -26,6 +26,10 @@ endif()
 add_executable(${Target})
 install(TARGETS ${Target})
 
+# add library (random engines and fill kernels, used by the executable and the tests)
+add_library(${Library} STATIC)
+target_link_libraries(${Target} PRIVATE ${Library})
+
 # set source and libraries directory
 add_subdirectory("src")
 add_subdirectory("libs")
@@ -34,26 +38,32 @@ include(cmake_files/warnings.cmake)
 include(cmake_files/define.cmake)
 include(cmake_files/compileropts.cmake)
 
-# force C++ Standard and disable/enable compiler specific extensions
-set_target_properties(${Target} PROPERTIES
-        CXX_STANDARD ${STANDARD}
-        CXX_STANDARD_REQUIRED ON
-        CXX_EXTENSIONS ${COMPILER_EXTENSIONS}
-)
+foreach(target ${Target} ${Library})
+    # force C++ Standard and disable/enable compiler specific extensions
+    set_target_properties(${target} PROPERTIES
+            CXX_STANDARD ${STANDARD}
+            CXX_STANDARD_REQUIRED ON
+            CXX_EXTENSIONS ${COMPILER_EXTENSIONS}
+    )
+
+    # compiler definitions and options
+    set_definitions(${target})
+    if (ENABLE_MULTITHREADING AND OPENMP)
+        set_options(${target} ON)
+    else ()
+        set_options(${target} OFF)
+    endif ()
 
-# compiler definitions and options
-set_definitions(${Target})
-if (ENABLE_MULTITHREADING AND OPENMP)
-    set_options(${Target} ON)
-else ()
-    set_options(${Target} OFF)
-endif ()
+    if (COMPILER_WARNINGS)
+        enable_warnings(${target})
+    else ()
+        disable_warnings(${target})
+    endif ()
+endforeach()
 
 if (COMPILER_WARNINGS)
-    enable_warnings(${Target})
     message(STATUS "Compiler warnings enabled.")
 else ()
-    disable_warnings(${Target})
     message(STATUS "Compiler warnings disabled.")
 endif ()
 
@@ -61,7 +71,7 @@ if (ENABLE_MULTITHREADING)
     # required by threading lib (std::thread)
     set(THREADS_PREFER_PTHREAD_FLAG ON)
     find_package(Threads REQUIRED)
-    target_link_libraries(${Target} PRIVATE Threads::Threads)
+    target_link_libraries(${Library} PUBLIC Threads::Threads)
 endif ()
 
 # lto
@@ -70,7 +80,7 @@ if(LTO_ENABLED)
     check_ipo_supported(RESULT ipo_supported OUTPUT error)
     if( ipo_supported )
         message(STATUS "IPO / LTO enabled")
-        set_property(TARGET ${Target} PROPERTY INTERPROCEDURAL_OPTIMIZATION TRUE)
+        set_property(TARGET ${Target} ${Library} PROPERTY INTERPROCEDURAL_OPTIMIZATION TRUE)
     else()
         message(STATUS "IPO / LTO not supported: <${error}>")
     endif()
@@ -120,6 +130,7 @@ if (CLANG_FORMAT)
     if (EXISTS ${CLANG_FORMAT_FILE})
         include(cmake_files/ClangFormat.cmake)
         target_clangformat_setup(${Target})
+        target_clangformat_setup(${Library})
         message(STATUS "Added clang format target(s)")
     else ()
         message(WARNING "Clang format enabled, but file ${CLANG_FORMAT_FILE}  does not exist")
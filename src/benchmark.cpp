@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "benchmark.hpp"
+
+#include "buffer.hpp"
+#include "fill.hpp"
+#include "parallel_fill.hpp"
+#include "scheduler.hpp"
+#include "sync.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cxxsemaphore.hpp>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <unistd.h>
+
+using bench_clock = std::chrono::steady_clock;
+
+/**
+ * \brief get a percentile (nearest rank) of sorted values
+ */
+static std::uint64_t percentile(const std::vector<std::uint64_t> &sorted, double p) {
+    const auto rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+
+static std::uint64_t elapsed_ns(bench_clock::time_point begin, bench_clock::time_point end) {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+}
+
+/**
+ * \brief create the synchronization of a benchmark combination
+ * @param type synchronization type
+ * @param seqlock_header memory for the seqlock header
+ * @return synchronization (nullptr: none)
+ */
+static std::unique_ptr<FrameSync> make_sync(const std::string &type, PrivateBuffer &seqlock_header) {
+    if (type == "none") return nullptr;
+
+    if (type == "semaphore") {
+        // private semaphore, created for the benchmark only (never contended: wait forever)
+        const auto                  name = "shared-mem-random-benchmark-" + std::to_string(getpid());
+        const SemaphoreSync::Policy policy {SemaphoreSync::strategy_t::TIMEOUT, std::chrono::nanoseconds::zero()};
+        return std::make_unique<SemaphoreSync>(std::make_unique<cxxsemaphore::Semaphore>(name, 1, true), policy);
+    }
+
+    if (type == "seqlock") return std::make_unique<SeqlockSync>(seqlock_header.get_addr());
+
+    throw std::invalid_argument("invalid sync type '" + type + '\'');
+}
+
+std::vector<BenchmarkResult> run_benchmark(const BenchmarkConfig &config, void *data, std::size_t size) {
+    if (config.iterations == 0) throw std::invalid_argument("number of iterations must not be 0");
+
+    PrivateBuffer seqlock_header(SeqlockSync::HEADER_SIZE);
+
+    // opened before the worker threads are created: the counters are inherited by all threads
+    std::unique_ptr<PerfCounters> perf;
+    if (config.perf) perf = std::make_unique<PerfCounters>();
+
+    std::vector<BenchmarkResult> results;
+    std::vector<std::uint64_t>   latency(config.iterations);
+    std::vector<std::uint64_t>   wait(config.iterations);
+
+    for (const auto &engine : config.engines) {
+        for (const auto threads : config.threads) {
+            if (Scheduler::termination_pending()) return results;
+            ParallelFill filler(engine, threads, 0, config.cpus, config.numa);
+            filler.set_distribution(config.distribution);
+
+            for (const auto alignment : config.alignments) {
+                const LaneMask mask(~static_cast<std::uint64_t>(0), alignment);
+                const auto     elements  = std::min(size / alignment, config.elements.value_or(size));
+                const auto     fill_size = elements * alignment;
+                if (elements == 0)
+                    throw std::invalid_argument("the benchmark memory area is smaller than one element of " +
+                                                std::to_string(alignment) + " bytes");
+
+                for (const auto &sync_type : config.syncs) {
+                    if (Scheduler::termination_pending()) return results;
+                    auto sync = make_sync(sync_type, seqlock_header);
+
+                    // warm up (page faults, NUMA placement, caches)
+                    filler.fill(data, fill_size, mask);
+
+                    const auto perf_start = perf ? perf->read() : PerfCounters::Sample {};
+                    const auto start = bench_clock::now();
+                    for (std::size_t i = 0; i < config.iterations; ++i) {
+                        const auto t0 = bench_clock::now();
+                        if (sync) sync->begin();
+                        const auto t1 = bench_clock::now();
+                        filler.fill(data, fill_size, mask);
+                        if (sync) sync->end();
+                        const auto t2 = bench_clock::now();
+
+                        wait[i]    = elapsed_ns(t0, t1);
+                        latency[i] = elapsed_ns(t0, t2);
+
+                        // the incomplete combination is discarded
+                        if (Scheduler::termination_pending()) return results;
+                    }
+                    const auto total = static_cast<double>(elapsed_ns(start, bench_clock::now()));
+                    const auto perf_total = perf ? PerfCounters::diff(perf->read(), perf_start) : perf_start;
+
+                    std::sort(latency.begin(), latency.end());
+
+                    const auto iterations = static_cast<double>(config.iterations);
+                    const auto wait_sum   = std::accumulate(wait.begin(), wait.end(), std::uint64_t {0});
+
+                    BenchmarkResult result;
+                    result.engine         = engine;
+                    result.alignment      = alignment;
+                    result.threads        = threads;
+                    result.sync           = sync_type;
+                    result.size           = fill_size;
+                    result.iterations     = config.iterations;
+                    result.gb_per_s       = static_cast<double>(fill_size) * iterations / total;
+                    result.ns_per_element = total / (iterations * static_cast<double>(elements));
+                    result.latency_p50    = percentile(latency, 0.5);    // NOLINT
+                    result.latency_p99    = percentile(latency, 0.99);   // NOLINT
+                    result.latency_p999   = percentile(latency, 0.999);  // NOLINT
+                    result.sync_wait_mean = static_cast<double>(wait_sum) / iterations;
+                    result.sync_wait_max  = *std::max_element(wait.begin(), wait.end());
+                    if (perf) {
+                        result.perf_events = perf->get_available();
+                        for (std::size_t i = 0; i < PerfCounters::EVENTS; ++i)
+                            result.perf[i] = static_cast<double>(perf_total[i]) / iterations;
+                    }
+                    results.push_back(result);
+                }
+            }
+        }
+    }
+
+    return results;
+}
+
+/**
+ * \brief check if a perf counter was measured
+ */
+static bool perf_available(const BenchmarkResult &result, std::size_t event) noexcept {
+    return result.perf_events & (std::uint64_t {1} << event);
+}
+
+void print_benchmark_csv(std::ostream &o, const std::vector<BenchmarkResult> &results) {
+    o << "engine,alignment,threads,sync,size,iterations,gb_per_s,ns_per_element,"
+         "latency_p50_ns,latency_p99_ns,latency_p999_ns,sync_wait_mean_ns,sync_wait_max_ns";
+    const bool perf = !results.empty() && results.front().perf_events;
+    if (perf) {
+        for (std::size_t i = 0; i < PerfCounters::EVENTS; ++i)
+            o << ',' << PerfCounters::event_name(i) << "_per_fill";
+    }
+    o << '\n';
+
+    for (const auto &r : results) {
+        o << r.engine << ',' << r.alignment << ',' << r.threads << ',' << r.sync << ',' << r.size << ','
+          << r.iterations << ',' << r.gb_per_s << ',' << r.ns_per_element << ',' << r.latency_p50 << ','
+          << r.latency_p99 << ',' << r.latency_p999 << ',' << r.sync_wait_mean << ',' << r.sync_wait_max;
+        if (perf) {
+            // empty field: counter not available
+            for (std::size_t i = 0; i < PerfCounters::EVENTS; ++i) {
+                o << ',';
+                if (perf_available(r, i)) o << r.perf[i];
+            }
+        }
+        o << '\n';
+    }
+}
+
+void print_benchmark_json(std::ostream &o, const std::vector<BenchmarkResult> &results) {
+    o << '[' << '\n';
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto &r = results[i];
+        o << "  {\"engine\": \"" << r.engine << "\", \"alignment\": " << r.alignment << ", \"threads\": " << r.threads
+          << ", \"sync\": \"" << r.sync << "\", \"size\": " << r.size << ", \"iterations\": " << r.iterations
+          << ", \"gb_per_s\": " << r.gb_per_s << ", \"ns_per_element\": " << r.ns_per_element
+          << ", \"latency_p50_ns\": " << r.latency_p50 << ", \"latency_p99_ns\": " << r.latency_p99
+          << ", \"latency_p999_ns\": " << r.latency_p999 << ", \"sync_wait_mean_ns\": " << r.sync_wait_mean
+          << ", \"sync_wait_max_ns\": " << r.sync_wait_max;
+        if (r.perf_events) {
+            o << ", \"perf_per_fill\": {";
+            for (std::size_t e = 0; e < PerfCounters::EVENTS; ++e) {
+                o << (e ? ", \"" : "\"") << PerfCounters::event_name(e) << "\": ";
+                if (perf_available(r, e)) o << r.perf[e];
+                else o << "null";
+            }
+            o << '}';
+        }
+        o << '}' << (i + 1 < results.size() ? "," : "") << '\n';
+    }
+
+    o << ']' << '\n';
+}
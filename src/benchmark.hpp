@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "distribution.hpp"
+#include "perf_counters.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+//* configuration of a benchmark run. Every combination of engine, alignment, thread count and sync is measured.
+struct BenchmarkConfig {
+    std::vector<std::string>            engines;         //*< random engines
+    std::vector<std::size_t>            alignments;      //*< alignments (1, 2, 4 or 8)
+    std::vector<std::size_t>            threads;         //*< thread counts
+    std::vector<std::string>            syncs;           //*< synchronization types (none, semaphore or seqlock)
+    std::size_t                         iterations = 0;  //*< measured fills per combination
+    std::vector<int>                    cpus;            //*< cpu list (see ParallelFill)
+    bool                                numa = false;    //*< NUMA placement (see ParallelFill)
+    std::shared_ptr<const Distribution> distribution;    //*< element distribution (nullptr: uniform random bits)
+    bool                                perf = false;    //*< measure the perf counters (see PerfCounters)
+    std::optional<std::size_t>          elements;        //*< maximum number of elements (default: whole memory area)
+};
+
+//* result of one benchmark combination (times in nanoseconds)
+struct BenchmarkResult {
+    std::string   engine;
+    std::size_t   alignment;
+    std::size_t   threads;
+    std::string   sync;
+    std::size_t   size;
+    std::size_t   iterations;
+    double        gb_per_s;
+    double        ns_per_element;
+    std::uint64_t latency_p50;
+    std::uint64_t latency_p99;
+    std::uint64_t latency_p999;
+    double        sync_wait_mean;
+    std::uint64_t sync_wait_max;
+
+    std::uint64_t                            perf_events = 0;  //*< available perf counters (0: not measured)
+    std::array<double, PerfCounters::EVENTS> perf {};          //*< perf counters per fill (mean)
+};
+
+/**
+ * \brief run the benchmark
+ * @details Every fill is measured including the synchronization (begin, fill, end).
+ *          The sync wait time is the duration of begin() (e.g. the semaphore wait).
+ *          The perf counters are read before and after all measured fills of a combination.
+ *          A pending SIGINT or SIGTERM (see Scheduler::block_signals()) stops the benchmark, only the completed
+ *          combinations are returned.
+ * @param config benchmark configuration
+ * @param data memory area that is filled
+ * @param size size of the memory area in bytes
+ * @return results (one per completed combination)
+ * @exception std::invalid_argument invalid configuration
+ * @exception std::runtime_error failed to create the synchronization
+ * @exception std::system_error failed to create the worker threads or to open the perf counters
+ */
+std::vector<BenchmarkResult> run_benchmark(const BenchmarkConfig &config, void *data, std::size_t size);
+
+/**
+ * \brief print benchmark results as CSV (with header line)
+ * @details The perf counter columns are only printed if the perf counters were measured.
+ * @param o output stream
+ * @param results benchmark results
+ */
+void print_benchmark_csv(std::ostream &o, const std::vector<BenchmarkResult> &results);
+
+/**
+ * \brief print benchmark results as JSON array
+ * @param o output stream
+ * @param results benchmark results
+ */
+void print_benchmark_json(std::ostream &o, const std::vector<BenchmarkResult> &results);
@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "buffer.hpp"
+
+#include <cerrno>
+#include <sys/mman.h>
+#include <system_error>
+
+PrivateBuffer::PrivateBuffer(std::size_t size) : size(size) {
+    addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) throw std::system_error(errno, std::generic_category(), "failed to allocate buffer");
+}
+
+PrivateBuffer::~PrivateBuffer() {
+    munmap(addr, size);
+}
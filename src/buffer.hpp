@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * \brief page aligned, private (anonymous) memory buffer
+ */
+class PrivateBuffer {
+private:
+    void       *addr = nullptr;
+    std::size_t size;
+
+public:
+    /**
+     * \brief allocate buffer
+     * @param size size in bytes
+     * @exception std::system_error failed to allocate the buffer
+     */
+    explicit PrivateBuffer(std::size_t size);
+
+    ~PrivateBuffer();
+
+    PrivateBuffer(const PrivateBuffer &)            = delete;
+    PrivateBuffer(PrivateBuffer &&)                 = delete;
+    PrivateBuffer &operator=(const PrivateBuffer &) = delete;
+    PrivateBuffer &operator=(PrivateBuffer &&)      = delete;
+
+    /**
+     * \brief get the buffer address
+     * @return buffer address
+     */
+    [[nodiscard]] std::uint8_t *get_addr() const noexcept { return static_cast<std::uint8_t *>(addr); }
+
+    /**
+     * \brief get the buffer size
+     * @return size in bytes
+     */
+    [[nodiscard]] std::size_t get_size() const noexcept { return size; }
+};
@@ -0,0 +1,610 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "distribution.hpp"
+
+#include "stream.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+//* number of random words that are generated at once
+static constexpr std::size_t WORD_BATCH = 256;
+
+//* size of the buffer that is used for streaming stores
+static constexpr std::size_t STREAM_BUFFER_SIZE = 4096;
+
+//* alignment of the streaming stores
+static constexpr std::size_t STREAM_ALIGNMENT = 64;
+
+//* 2^-53
+static constexpr double UNIT_53 = 0x1p-53;
+
+/**
+ * \brief convert the upper 53 bits of a random word to a double in [0, 1)
+ */
+static inline double unit_double(std::uint64_t word) noexcept {
+    // signed conversion: single instruction on x86-64 (the value fits into 53 bits)
+    return static_cast<double>(static_cast<std::int64_t>(word >> 11U)) * UNIT_53;  // NOLINT
+}
+
+/**
+ * \brief convert the upper 53 bits of a random word to a double in (0, 1]
+ */
+static inline double unit_double_nonzero(std::uint64_t word) noexcept {
+    return static_cast<double>(static_cast<std::int64_t>(word >> 11U) + 1) * UNIT_53;  // NOLINT
+}
+
+/**
+ * \brief convert a value to the element type
+ * @details Integers are rounded to the nearest value and saturated.
+ */
+template <typename T>
+static inline T convert(double value) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        return static_cast<T>(value);
+    } else {
+        const auto rounded = std::nearbyint(value);
+        if (rounded <= static_cast<double>(std::numeric_limits<T>::min())) return std::numeric_limits<T>::min();
+        if (rounded >= static_cast<double>(std::numeric_limits<T>::max())) return std::numeric_limits<T>::max();
+        return static_cast<T>(rounded);
+    }
+}
+
+/**
+ * \brief ziggurat tables (George Marsaglia and Wai Wan Tsang, "The Ziggurat Method for Generating Random Variables")
+ * @details x[i] is the right edge of layer i, f[i] the density at x[i]. x[0] is the width of the base layer
+ *          (including the tail), x[N] = 0.
+ */
+template <std::size_t N>
+struct ZigguratTable {
+    static constexpr std::size_t LAYERS = N;
+
+    std::array<double, N + 1> x {};
+    std::array<double, N + 1> f {};
+    double                    r;
+
+    /**
+     * \brief compute the tables
+     * @param r start of the tail
+     * @param v area of every layer
+     * @param density (unnormalized) density function
+     * @param inverse inverse of the density function
+     */
+    template <typename Density, typename Inverse>
+    ZigguratTable(double r, double v, Density density, Inverse inverse) : r(r) {
+        x[0] = v / density(r);
+        x[1] = r;
+        for (std::size_t i = 2; i < N; ++i)
+            x[i] = inverse(v / x[i - 1] + density(x[i - 1]));
+        x[N] = 0;
+
+        for (std::size_t i = 0; i <= N; ++i)
+            f[i] = density(x[i]);
+    }
+};
+
+using NormalTable      = ZigguratTable<128>;  // NOLINT
+using ExponentialTable = ZigguratTable<256>;  // NOLINT
+
+static const NormalTable &normal_table() {
+    static const NormalTable TABLE(
+            3.442619855899,         // NOLINT
+            9.91256303526217e-3,    // NOLINT
+            [](double x) { return std::exp(-0.5 * x * x); },        // NOLINT
+            [](double y) { return std::sqrt(-2.0 * std::log(y)); });  // NOLINT
+    return TABLE;
+}
+
+static const ExponentialTable &exponential_table() {
+    static const ExponentialTable TABLE(
+            7.69711747013104972,   // NOLINT
+            3.949659822581572e-3,  // NOLINT
+            [](double x) { return std::exp(-x); },
+            [](double y) { return -std::log(y); });
+    return TABLE;
+}
+
+/**
+ * \brief rejection part of ziggurat_normal (outside of the layer rectangle, ~1.2%)
+ */
+[[gnu::noinline]] static double
+        ziggurat_normal_slow(const NormalTable &table, std::uint64_t i, double z, RandomEngine &engine) {
+    for (;;) {
+        if (i == 0) {
+            // tail (x > r)
+            double a;
+            double b;
+            do {
+                a = -std::log(unit_double_nonzero(engine())) / table.r;
+                b = -std::log(unit_double_nonzero(engine()));
+            } while (b + b < a * a);
+            return z > 0 ? table.r + a : -(table.r + a);
+        }
+
+        const auto y = table.f[i] + unit_double(engine()) * (table.f[i + 1] - table.f[i]);
+        if (y < std::exp(-0.5 * z * z)) return z;  // NOLINT
+
+        const auto word = engine();
+        i               = word & (NormalTable::LAYERS - 1);
+        z               = (2.0 * unit_double(word) - 1.0) * table.x[i];
+        if (std::fabs(z) < table.x[i + 1]) return z;
+    }
+}
+
+/**
+ * \brief standard normal distributed value (ziggurat)
+ * @details The lower 7 bits of the word select the layer, the upper 53 bits the position within the layer.
+ *          Additional random words are only required if the value is not inside of the layer rectangle.
+ */
+static inline double ziggurat_normal(const NormalTable &table, std::uint64_t word, RandomEngine &engine) {
+    const auto i = word & (NormalTable::LAYERS - 1);
+    const auto z = (2.0 * unit_double(word) - 1.0) * table.x[i];
+    if (std::fabs(z) < table.x[i + 1]) [[likely]]
+        return z;
+    return ziggurat_normal_slow(table, i, z, engine);
+}
+
+/**
+ * \brief rejection part of ziggurat_exponential (outside of the layer rectangle, ~1.1%)
+ */
+[[gnu::noinline]] static double
+        ziggurat_exponential_slow(const ExponentialTable &table, std::uint64_t i, double z, RandomEngine &engine) {
+    for (;;) {
+        if (i == 0) return table.r - std::log(unit_double_nonzero(engine()));
+
+        const auto y = table.f[i] + unit_double(engine()) * (table.f[i + 1] - table.f[i]);
+        if (y < std::exp(-z)) return z;
+
+        const auto word = engine();
+        i               = word & (ExponentialTable::LAYERS - 1);
+        z               = unit_double(word) * table.x[i];
+        if (z < table.x[i + 1]) return z;
+    }
+}
+
+/**
+ * \brief standard exponential distributed value (ziggurat)
+ * @details The lower 8 bits of the word select the layer, the upper 53 bits the position within the layer.
+ */
+static inline double ziggurat_exponential(const ExponentialTable &table, std::uint64_t word, RandomEngine &engine) {
+    const auto i = word & (ExponentialTable::LAYERS - 1);
+    const auto z = unit_double(word) * table.x[i];
+    if (z < table.x[i + 1]) [[likely]]
+        return z;
+    return ziggurat_exponential_slow(table, i, z, engine);
+}
+
+/**
+ * \brief uniform integers in [base, base + span) (Daniel Lemire, "Fast Random Integer Generation in an Interval")
+ * @details 8 bit elements use 16 bit draws, 16 bit elements 32 bit draws (rejection probability below 2^-8 and
+ *          2^-16), so one random word yields 4 or 2 elements.
+ */
+template <typename T>
+struct UniformInt {
+    //* width of a random draw
+    static constexpr unsigned BITS = sizeof(T) == 1 ? 16 : sizeof(T) == 2 ? 32 : 64;  // NOLINT
+
+    std::uint64_t base;
+    std::uint64_t span;       //*< 0: full 64 bit range
+    std::uint64_t threshold;  //*< (2^BITS - span) % span
+
+    UniformInt(std::uint64_t base, std::uint64_t span) : base(base), span(span) {
+        if constexpr (BITS == 64) threshold = span ? (0 - span) % span : 0;  // NOLINT
+        else threshold = ((std::uint64_t {1} << BITS) - span) % span;
+    }
+
+    T operator()(std::uint64_t draw, RandomEngine &engine) const {
+        if constexpr (BITS == 64) {
+            if (span == 0) return static_cast<T>(draw);
+
+            auto m = static_cast<uint128_t>(draw) * span;
+            while (static_cast<std::uint64_t>(m) < threshold)
+                m = static_cast<uint128_t>(engine()) * span;
+            return static_cast<T>(base + static_cast<std::uint64_t>(m >> 64U));  // NOLINT
+        } else {
+            // draw and span have at most BITS and BITS / 2 + 1 bits: the product fits into 64 bits
+            static constexpr std::uint64_t LOW = (std::uint64_t {1} << BITS) - 1;
+
+            auto m = draw * span;
+            while ((m & LOW) < threshold)
+                m = (engine() >> (64U - BITS)) * span;  // NOLINT
+            return static_cast<T>(base + (m >> BITS));
+        }
+    }
+};
+
+/**
+ * \brief uniform floating point values in [min, max)
+ * @details float elements use 32 bit draws (24 bit mantissa), so one random word yields 2 elements.
+ */
+template <typename T>
+struct UniformReal {
+    //* width of a random draw
+    static constexpr unsigned BITS = std::is_same_v<T, float> ? 32 : 64;  // NOLINT
+
+    T min;
+    T width;  //*< max - min
+    T last;   //*< largest value below max
+
+    T operator()(std::uint64_t draw, RandomEngine &) const noexcept {
+        T value;
+        if constexpr (std::is_same_v<T, float>) {
+            value = min + static_cast<float>(static_cast<std::int32_t>(draw >> 8U)) * 0x1p-24F * width;  // NOLINT
+        } else {
+            value = min + unit_double(draw) * width;
+        }
+        return std::min(value, last);  // rounding can yield max
+    }
+};
+
+//* normal distribution
+template <typename T>
+struct Normal {
+    const NormalTable *table;
+    double             mean;
+    double             stddev;
+
+    T operator()(std::uint64_t word, RandomEngine &engine) const {
+        return convert<T>(mean + stddev * ziggurat_normal(*table, word, engine));
+    }
+};
+
+//* exponential distribution
+template <typename T>
+struct Exponential {
+    const ExponentialTable *table;
+    double                  scale;  //*< 1 / lambda
+
+    T operator()(std::uint64_t word, RandomEngine &engine) const {
+        return convert<T>(scale * ziggurat_exponential(*table, word, engine));
+    }
+};
+
+//* discrete distribution (alias method by Alastair J. Walker, table construction by Michael D. Vose)
+template <typename T>
+struct Discrete {
+    //* table entry: value[1] is selected with the given probability, value[0] (the alias) otherwise
+    struct Entry {
+        std::uint64_t    threshold;  //*< probability of value[1] (scaled to 2^64)
+        std::array<T, 2> value;
+    };
+
+    std::vector<Entry> table;
+
+    /**
+     * \brief build the alias table
+     * @param values values
+     * @param weights weights (> 0)
+     */
+    Discrete(const std::vector<T> &values, const std::vector<double> &weights) : table(values.size()) {
+        const auto n   = weights.size();
+        const auto sum = std::accumulate(weights.begin(), weights.end(), 0.0);
+
+        std::vector<double>      probability(n);
+        std::vector<std::size_t> small;
+        std::vector<std::size_t> large;
+        for (std::size_t i = 0; i < n; ++i) {
+            probability[i] = weights[i] * static_cast<double>(n) / sum;
+            (probability[i] < 1.0 ? small : large).push_back(i);
+        }
+
+        while (!small.empty() && !large.empty()) {
+            const auto s = small.back();
+            const auto l = large.back();
+            small.pop_back();
+            large.pop_back();
+
+            table[s] = {probability_threshold(probability[s]), {values[l], values[s]}};
+
+            probability[l] = (probability[l] + probability[s]) - 1.0;
+            (probability[l] < 1.0 ? small : large).push_back(l);
+        }
+
+        // remaining entries have a probability of 1 (up to rounding errors): they are their own alias
+        for (const auto &list : {large, small}) {
+            for (const auto i : list)
+                table[i] = {std::numeric_limits<std::uint64_t>::max(), {values[i], values[i]}};
+        }
+    }
+
+    static std::uint64_t probability_threshold(double probability) noexcept {
+        const auto scaled = probability * 0x1p64;  // NOLINT
+        if (scaled >= 0x1p64) return std::numeric_limits<std::uint64_t>::max();
+        return static_cast<std::uint64_t>(scaled);
+    }
+
+    T operator()(std::uint64_t word, RandomEngine &) const noexcept {
+        // upper 64 bits: table index, lower 64 bits: uniform value to select between entry and alias
+        const auto  m     = static_cast<uint128_t>(word) * table.size();
+        const auto &entry = table[static_cast<std::size_t>(m >> 64U)];  // NOLINT
+        return entry.value[static_cast<std::uint64_t>(m) < entry.threshold];  // index instead of branch
+    }
+};
+
+/**
+ * \brief width of the random draws of a sampler
+ * @return Sampler::BITS (16, 32 or 64) if defined, 64 otherwise
+ */
+template <typename Sampler>
+static constexpr unsigned draw_bits() noexcept {
+    if constexpr (requires { Sampler::BITS; }) return Sampler::BITS;
+    else return 64;  // NOLINT
+}
+
+/**
+ * \brief distribution of elements of type T, shaped by a sampler
+ * @details The sampler converts one random draw to one element. A draw is a whole random word or, for samplers
+ *          with less than 64 bits per draw (see draw_bits), a part of it (least significant part first).
+ *          The sampler can request additional random words from the engine if required (rejection sampling).
+ */
+template <typename T, typename Sampler>
+class ShapedDistribution final : public Distribution {
+    static constexpr unsigned      BITS      = draw_bits<Sampler>();
+    static constexpr std::size_t   PER_WORD  = 64 / BITS;  // NOLINT
+    static constexpr std::uint64_t DRAW_MASK = ~std::uint64_t {0} >> (64U - BITS);  // NOLINT
+
+    Sampler     sampler;
+    std::string description;
+
+public:
+    ShapedDistribution(Sampler sampler, std::string description)
+        : sampler(std::move(sampler)), description(std::move(description)) {}
+
+    void generate(void *data, std::size_t count, RandomEngine &engine) const override {
+        auto *out = static_cast<std::uint8_t *>(data);
+
+        // the elements are collected in a local buffer, so the sampler state can be kept in registers
+        std::array<std::uint64_t, WORD_BATCH> words;
+        std::array<T, WORD_BATCH * PER_WORD>  values;
+        while (count) {
+            const auto n       = std::min(count, values.size());
+            const auto n_words = (n + PER_WORD - 1) / PER_WORD;
+            engine.fill(words.data(), n_words, ~static_cast<std::uint64_t>(0));
+            for (std::size_t w = 0; w < n_words; ++w) {
+                auto word = words[w];
+                for (std::size_t d = 0; d < PER_WORD; ++d) {
+                    values[w * PER_WORD + d] = sampler(word & DRAW_MASK, engine);
+                    if constexpr (BITS < 64) word >>= BITS;  // NOLINT
+                }
+            }
+            std::memcpy(out, values.data(), n * sizeof(T));
+            out += n * sizeof(T);
+            count -= n;
+        }
+    }
+
+    [[nodiscard]] std::size_t element_size() const noexcept override { return sizeof(T); }
+
+    [[nodiscard]] std::string describe() const override { return description; }
+};
+
+/**
+ * \brief parse a value of the element type (whole string)
+ */
+template <typename T>
+static T parse_value(const std::string &str, const std::string &spec) {
+    const auto error = [&]() {
+        return std::invalid_argument("invalid value '" + str + "' in distribution '" + spec + '\'');
+    };
+
+    std::size_t idx = 0;
+    T           value;
+    try {
+        if constexpr (std::is_floating_point_v<T>) {
+            const auto tmp = std::stod(str, &idx);
+            if (!std::isfinite(tmp) || std::fabs(tmp) > static_cast<double>(std::numeric_limits<T>::max()))
+                throw error();
+            value = static_cast<T>(tmp);
+        } else if constexpr (std::is_signed_v<T>) {
+            const auto tmp = std::stoll(str, &idx, 0);
+            if (tmp < std::numeric_limits<T>::min() || tmp > std::numeric_limits<T>::max()) throw error();
+            value = static_cast<T>(tmp);
+        } else {
+            if (!str.empty() && str.front() == '-') throw error();
+            const auto tmp = std::stoull(str, &idx, 0);
+            if (tmp > std::numeric_limits<T>::max()) throw error();
+            value = static_cast<T>(tmp);
+        }
+    } catch (const std::invalid_argument &) { throw error(); } catch (const std::out_of_range &) {
+        throw error();
+    }
+    if (idx != str.size()) throw error();
+    return value;
+}
+
+/**
+ * \brief parse a double (whole string)
+ */
+static double parse_double(const std::string &str, const std::string &spec) {
+    return parse_value<double>(str, spec);
+}
+
+/**
+ * \brief split a string
+ */
+static std::vector<std::string> split(const std::string &str, char delimiter) {
+    std::vector<std::string> items;
+    std::size_t              pos = 0;
+    while (pos <= str.size()) {
+        const auto end = std::min(str.find(delimiter, pos), str.size());
+        items.push_back(str.substr(pos, end - pos));
+        pos = end + 1;
+    }
+    return items;
+}
+
+template <typename T>
+static std::unique_ptr<Distribution> make_typed(const std::string              &name,
+                                                const std::vector<std::string> &params,
+                                                const std::string              &spec,
+                                                const std::string              &type) {
+    const auto invalid = [&]() { return std::invalid_argument("invalid distribution '" + spec + '\''); };
+
+    std::ostringstream description;
+
+    if (name == "uniform") {
+        if (params.size() != 2) throw invalid();
+        const auto min = parse_value<T>(params[0], spec);
+        const auto max = parse_value<T>(params[1], spec);
+        description << "uniform(" << params[0] << ", " << params[1] << ") " << type;
+
+        if constexpr (std::is_floating_point_v<T>) {
+            const T width = max - min;
+            if (!(min < max) || !std::isfinite(width)) throw invalid();
+            return std::make_unique<ShapedDistribution<T, UniformReal<T>>>(
+                    UniformReal<T> {min, width, std::nextafter(max, min)}, description.str());
+        } else {
+            if (max < min) throw invalid();
+            const auto base = static_cast<std::uint64_t>(min);
+            const auto span = static_cast<std::uint64_t>(max) - base + 1;  // 0: full 64 bit range
+            return std::make_unique<ShapedDistribution<T, UniformInt<T>>>(UniformInt<T>(base, span),
+                                                                         description.str());
+        }
+    }
+
+    if (name == "normal") {
+        if (params.size() != 2) throw invalid();
+        const auto mean   = parse_double(params[0], spec);
+        const auto stddev = parse_double(params[1], spec);
+        if (!(stddev > 0)) throw invalid();
+        description << "normal(" << params[0] << ", " << params[1] << ") " << type;
+        return std::make_unique<ShapedDistribution<T, Normal<T>>>(Normal<T> {&normal_table(), mean, stddev},
+                                                                 description.str());
+    }
+
+    if (name == "exponential") {
+        if (params.size() != 1) throw invalid();
+        const auto lambda = parse_double(params[0], spec);
+        if (!(lambda > 0)) throw invalid();
+        description << "exponential(" << params[0] << ") " << type;
+        return std::make_unique<ShapedDistribution<T, Exponential<T>>>(
+                Exponential<T> {&exponential_table(), 1.0 / lambda}, description.str());
+    }
+
+    if (name == "discrete") {
+        if (params.empty() || params.size() > std::numeric_limits<std::uint32_t>::max()) throw invalid();
+        std::vector<T>      values;
+        std::vector<double> weights;
+        for (const auto &param : params) {
+            const auto equal = param.find('=');
+            if (equal == std::string::npos) throw invalid();
+            values.push_back(parse_value<T>(param.substr(0, equal), spec));
+            weights.push_back(parse_double(param.substr(equal + 1), spec));
+            if (!(weights.back() > 0)) throw invalid();
+        }
+        description << "discrete(" << params.size() << " values) " << type;
+        return std::make_unique<ShapedDistribution<T, Discrete<T>>>(Discrete<T>(values, weights),
+                                                                   description.str());
+    }
+
+    throw std::invalid_argument("unknown distribution '" + name + '\'');
+}
+
+std::unique_ptr<Distribution> make_distribution(const std::string &spec, const std::string &type) {
+    const auto colon = spec.find(':');
+    if (colon == std::string::npos || colon + 1 == spec.size())
+        throw std::invalid_argument("invalid distribution '" + spec + '\'');
+
+    const auto name   = spec.substr(0, colon);
+    const auto params = split(spec.substr(colon + 1), ',');
+
+    if (type == "u8") return make_typed<std::uint8_t>(name, params, spec, type);
+    if (type == "i8") return make_typed<std::int8_t>(name, params, spec, type);
+    if (type == "u16") return make_typed<std::uint16_t>(name, params, spec, type);
+    if (type == "i16") return make_typed<std::int16_t>(name, params, spec, type);
+    if (type == "u32") return make_typed<std::uint32_t>(name, params, spec, type);
+    if (type == "i32") return make_typed<std::int32_t>(name, params, spec, type);
+    if (type == "u64") return make_typed<std::uint64_t>(name, params, spec, type);
+    if (type == "i64") return make_typed<std::int64_t>(name, params, spec, type);
+    if (type == "f32") return make_typed<float>(name, params, spec, type);
+    if (type == "f64") return make_typed<double>(name, params, spec, type);
+    throw std::invalid_argument("unknown element type '" + type + '\'');
+}
+
+const std::vector<std::string> &element_type_names() {
+    static const std::vector<std::string> NAMES {"u8", "i8", "u16", "i16", "u32", "i32", "u64", "i64", "f32", "f64"};
+    return NAMES;
+}
+
+std::size_t element_type_size(const std::string &type) {
+    if (type == "u8" || type == "i8") return 1;
+    if (type == "u16" || type == "i16") return 2;
+    if (type == "u32" || type == "i32" || type == "f32") return 4;  // NOLINT
+    if (type == "u64" || type == "i64" || type == "f64") return 8;  // NOLINT
+    throw std::invalid_argument("unknown element type '" + type + '\'');
+}
+
+/**
+ * \brief write a part of one element
+ * @param data destination
+ * @param skip number of bytes of the element that are not written
+ * @param size number of bytes that are written
+ */
+static void write_partial(std::uint8_t      *data,
+                          std::size_t        skip,
+                          std::size_t        size,
+                          const Distribution &distribution,
+                          RandomEngine       &engine) {
+    std::array<std::uint8_t, sizeof(std::uint64_t)> element {};
+    distribution.generate(element.data(), 1, engine);
+    std::memcpy(data, element.data() + skip, size);
+}
+
+void fill_distribution(void               *data,
+                       std::size_t         size,
+                       const Distribution &distribution,
+                       RandomEngine       &engine,
+                       std::size_t         byte_offset,
+                       bool                stream) {
+    const auto element_size = distribution.element_size();
+    auto      *bytes        = static_cast<std::uint8_t *>(data);
+    std::size_t pos         = 0;
+
+    const auto skip = byte_offset % element_size;
+    if (skip) {
+        pos = std::min(size, element_size - skip);
+        write_partial(bytes, skip, pos, distribution, engine);
+    }
+
+    auto elements = (size - pos) / element_size;
+
+    // The elements are generated in pieces that only depend on the position in the memory area (not on the address
+    // or the store type): the number of random words that a rejection sampler consumes makes the output depend on
+    // the split. The first piece ends at a 64 byte boundary of the memory area (usually a 64 byte aligned address).
+    const auto position = (byte_offset + pos) % STREAM_ALIGNMENT;
+    if (elements && position) {
+        const auto head = std::min(elements, (STREAM_ALIGNMENT - position) / element_size);
+        distribution.generate(bytes + pos, head, engine);
+        pos += head * element_size;
+        elements -= head;
+    }
+
+    // the elements can only reach a 64 byte boundary if they are aligned to their size (normal stores otherwise)
+    const bool aligned = reinterpret_cast<std::uintptr_t>(bytes + pos) % element_size == 0;  // NOLINT
+
+    alignas(STREAM_ALIGNMENT) std::array<std::uint8_t, STREAM_BUFFER_SIZE> buffer;
+    while (elements) {
+        const auto n = std::min(elements, buffer.size() / element_size);
+        if (stream && aligned) {
+            distribution.generate(buffer.data(), n, engine);
+            stream_copy(bytes + pos, buffer.data(), n * element_size);
+        } else {
+            distribution.generate(bytes + pos, n, engine);
+        }
+        pos += n * element_size;
+        elements -= n;
+    }
+
+    if (pos < size) write_partial(bytes + pos, 0, size - pos, distribution, engine);
+}
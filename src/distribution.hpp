@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "engine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * \brief value distribution of the generated elements
+ * @details Distributions are immutable after construction (all lookup tables are precomputed).
+ *          The same distribution can be used by multiple threads simultaneously, every thread with its own engine.
+ */
+class Distribution {
+public:
+    virtual ~Distribution() = default;
+
+    /**
+     * \brief generate elements
+     * @details The random words are generated in bulk by the engine (see RandomEngine::fill) and shaped afterwards.
+     *          The elements are written in native endianness. The destination does not need to be aligned.
+     * @param data destination
+     * @param count number of elements
+     * @param engine random engine
+     */
+    virtual void generate(void *data, std::size_t count, RandomEngine &engine) const = 0;
+
+    /**
+     * \brief get the element size
+     * @return element size in bytes (1, 2, 4 or 8)
+     */
+    [[nodiscard]] virtual std::size_t element_size() const noexcept = 0;
+
+    /**
+     * \brief get a description of the distribution
+     * @return description (e.g. "normal(0, 1) f64")
+     */
+    [[nodiscard]] virtual std::string describe() const = 0;
+};
+
+/**
+ * \brief create a distribution
+ * @details Distribution specification (numbers in decimal or scientific notation):
+ *          - uniform:MIN,MAX (integers: [MIN, MAX], Lemire's bounded integers; floats: [MIN, MAX))
+ *          - normal:MEAN,STDDEV (ziggurat)
+ *          - exponential:LAMBDA (ziggurat)
+ *          - discrete:VALUE=WEIGHT,VALUE=WEIGHT,... (alias table)
+ *
+ *          Values of the normal and exponential distribution are rounded and saturated for integer element types.
+ * @param spec distribution specification
+ * @param type element type (u8, i8, u16, i16, u32, i32, u64, i64, f32 or f64)
+ * @return distribution
+ * @exception std::invalid_argument invalid specification or element type
+ */
+std::unique_ptr<Distribution> make_distribution(const std::string &spec, const std::string &type);
+
+/**
+ * \brief get the names of all element types
+ * @return element type names
+ */
+const std::vector<std::string> &element_type_names();
+
+/**
+ * \brief get the size of an element type
+ * @param type element type (see element_type_names())
+ * @return element size in bytes
+ * @exception std::invalid_argument unknown element type
+ */
+std::size_t element_type_size(const std::string &type);
+
+/**
+ * \brief fill a memory area with elements of a distribution
+ * @details Elements that are cut by the begin or end of the memory area are written partially.
+ *
+ *          With streaming stores, the elements are generated into a small, cache resident buffer and copied with
+ *          non-temporal stores (see stream_copy). stream_fence() has to be called by the same thread before the data
+ *          is published. Elements that are not aligned to their size are written with normal stores, because they
+ *          never reach a 64 byte boundary.
+ *
+ *          The elements only depend on the engine and byte_offset, not on the address or the store type.
+ * @param data pointer to memory area
+ * @param size size of the memory area in bytes
+ * @param distribution distribution of the elements
+ * @param engine random engine
+ * @param byte_offset offset of data (in bytes) relative to the start of the first element
+ * @param stream use streaming stores
+ */
+void fill_distribution(void               *data,
+                       std::size_t         size,
+                       const Distribution &distribution,
+                       RandomEngine       &engine,
+                       std::size_t         byte_offset,
+                       bool                stream);
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "engine.hpp"
+
+#include "engine_simd.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <sys/random.h>
+#include <unistd.h>
+
+std::uint64_t entropy_seed() noexcept {
+    std::uint64_t seed = 0;
+    if (getrandom(&seed, sizeof(seed), GRND_NONBLOCK) == static_cast<ssize_t>(sizeof(seed))) return seed;
+
+    const auto now = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    return derive_seed(now, static_cast<std::uint64_t>(getpid()), 0, 0);
+}
+
+const std::vector<std::string> &engine_names() {
+    static const std::vector<std::string> NAMES {
+            "xoshiro256x8", "xoshiro256ss", "wyrand", "splitmix64", "pcg64", "mt19937_64", "minstd"};
+    return NAMES;
+}
+
+std::unique_ptr<RandomEngine> make_engine(const std::string &name, std::uint64_t seed) {
+    if (name == "xoshiro256x8") return std::make_unique<RandomEngineImpl<Xoshiro256x8>>(name, seed);
+    if (name == "xoshiro256ss") return std::make_unique<RandomEngineImpl<Xoshiro256ss>>(name, seed);
+    if (name == "wyrand") return std::make_unique<RandomEngineImpl<WyRand>>(name, seed);
+    if (name == "splitmix64") return std::make_unique<RandomEngineImpl<SplitMix64>>(name, seed);
+    if (name == "pcg64") return std::make_unique<RandomEngineImpl<PCG64>>(name, seed);
+    if (name == "mt19937_64") return std::make_unique<RandomEngineImpl<MT19937_64>>(name, seed);
+    if (name == "minstd") return std::make_unique<RandomEngineImpl<Minstd>>(name, seed);
+
+    throw std::invalid_argument("unknown random engine '" + name + '\'');
+}
@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+//* unsigned 128 bit integer (gcc/clang extension)
+__extension__ using uint128_t = unsigned __int128;
+
+/**
+ * \brief splitmix64 generator
+ * @details Also used to expand a single 64 bit seed into the state of the other generators.
+ */
+class SplitMix64 {
+public:
+    using result_type = std::uint64_t;
+
+private:
+    result_type state;
+
+public:
+    explicit SplitMix64(result_type seed) noexcept : state(seed) {}
+
+    void seed(result_type seed) noexcept { state = seed; }
+
+    static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() noexcept {
+        result_type z = (state += 0x9E3779B97F4A7C15ULL);          // NOLINT
+        z             = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;  // NOLINT
+        z             = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;  // NOLINT
+        return z ^ (z >> 31U);                                     // NOLINT
+    }
+};
+
+/**
+ * \brief derive the seed of an independent random stream
+ * @details Every argument is mixed into the seed with the splitmix64 output function,
+ *          so streams with different keys use unrelated seeds.
+ * @param seed base seed
+ * @param generation generation (e.g. fill counter)
+ * @param stream stream (e.g. region index)
+ * @param offset offset (e.g. byte offset of the stream in the memory area)
+ * @return derived seed
+ */
+inline std::uint64_t
+        derive_seed(std::uint64_t seed, std::uint64_t generation, std::uint64_t stream, std::uint64_t offset) noexcept {
+    SplitMix64 sm(seed);
+    auto       hash = sm();
+    for (const auto key : {generation, stream, offset}) {
+        sm.seed(hash ^ key);
+        hash = sm();
+    }
+    return hash;
+}
+
+/**
+ * \brief get a random seed from the kernel
+ * @details Uses a single getrandom system call (no file is opened).
+ *          Falls back to the clock mixed with the process id if getrandom fails.
+ * @return random seed
+ */
+std::uint64_t entropy_seed() noexcept;
+
+/**
+ * \brief xoshiro256** generator by David Blackman and Sebastiano Vigna
+ */
+class Xoshiro256ss {
+public:
+    using result_type = std::uint64_t;
+
+private:
+    std::array<result_type, 4> s {};
+
+    static constexpr result_type rotl(result_type x, unsigned k) noexcept { return (x << k) | (x >> (64U - k)); }
+
+public:
+    explicit Xoshiro256ss(result_type seed) noexcept { this->seed(seed); }
+
+    void seed(result_type seed) noexcept {
+        SplitMix64 sm(seed);
+        for (auto &x : s)
+            x = sm();
+    }
+
+    /**
+     * \brief advance the generator by 2^128 steps
+     * @details Can be used to generate 2^128 non-overlapping sequences.
+     */
+    void jump() noexcept {
+        static constexpr std::array<result_type, 4> JUMP {
+                0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+
+        std::array<result_type, 4> tmp {};
+        for (const auto j : JUMP) {
+            for (unsigned b = 0; b < 64; ++b) {  // NOLINT
+                if (j & (result_type {1} << b)) {
+                    for (std::size_t i = 0; i < tmp.size(); ++i)
+                        tmp[i] ^= s[i];  // NOLINT
+                }
+                operator()();
+            }
+        }
+        s = tmp;
+    }
+
+    /**
+     * \brief get the internal state
+     * @return generator state
+     */
+    [[nodiscard]] const std::array<result_type, 4> &get_state() const noexcept { return s; }
+
+    static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() noexcept {
+        const result_type result = rotl(s[1] * 5, 7) * 9;  // NOLINT
+        const result_type t      = s[1] << 17U;            // NOLINT
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);  // NOLINT
+        return result;
+    }
+};
+
+/**
+ * \brief wyrand generator by Wang Yi
+ */
+class WyRand {
+public:
+    using result_type = std::uint64_t;
+
+private:
+    result_type state;
+
+public:
+    explicit WyRand(result_type seed) noexcept : state(seed) {}
+
+    void seed(result_type seed) noexcept { state = seed; }
+
+    static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() noexcept {
+        state += 0xA0761D6478BD642FULL;                                                  // NOLINT
+        const auto t = static_cast<uint128_t>(state) * (state ^ 0xE7037ED1A0B428DBULL);  // NOLINT
+        return static_cast<result_type>(t >> 64U) ^ static_cast<result_type>(t);         // NOLINT
+    }
+};
+
+/**
+ * \brief PCG64 generator (128 bit LCG with XSL RR output function) by Melissa O'Neill
+ */
+class PCG64 {
+public:
+    using result_type = std::uint64_t;
+
+private:
+    static constexpr uint128_t MULTIPLIER =
+            (static_cast<uint128_t>(2549297995355413924ULL) << 64U) + 4865540595714422341ULL;  // NOLINT
+    static constexpr uint128_t INCREMENT =
+            (static_cast<uint128_t>(6364136223846793005ULL) << 64U) + 1442695040888963407ULL;  // NOLINT
+
+    uint128_t state {};
+
+public:
+    explicit PCG64(result_type seed) noexcept { this->seed(seed); }
+
+    void seed(result_type seed) noexcept {
+        SplitMix64 sm(seed);
+        const auto hi = sm();
+        state         = (static_cast<uint128_t>(hi) << 64U) | sm();  // NOLINT
+        operator()();
+    }
+
+    static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() noexcept {
+        state          = state * MULTIPLIER + INCREMENT;
+        const auto rot = static_cast<unsigned>(state >> 122U);                                       // NOLINT
+        const auto x   = static_cast<result_type>(state >> 64U) ^ static_cast<result_type>(state);  // NOLINT
+        return (x >> rot) | (x << ((64U - rot) & 63U));                                              // NOLINT
+    }
+};
+
+/**
+ * \brief std::mt19937_64
+ */
+class MT19937_64 {
+public:
+    using result_type = std::uint64_t;
+
+private:
+    std::mt19937_64 gen;
+
+public:
+    explicit MT19937_64(result_type seed) : gen(seed) {}
+
+    void seed(result_type seed) { gen.seed(seed); }
+
+    static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() { return gen(); }
+};
+
+/**
+ * \brief std::default_random_engine (minstd on libstdc++)
+ * @details This is the engine that was used by previous versions of this application.
+ *          Several calls to the underlying engine are combined to provide 64 bit per call.
+ */
+class Minstd {
+public:
+    using result_type = std::uint64_t;
+
+private:
+    std::independent_bits_engine<std::default_random_engine, 64, result_type> gen;
+
+public:
+    explicit Minstd(result_type seed) : gen(seed) {}
+
+    void seed(result_type seed) { gen.seed(seed); }
+
+    static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() { return gen(); }
+};
+
+/**
+ * \brief common interface of all random engines
+ * @details Satisfies the UniformRandomBitGenerator requirements. Every call yields 64 random bits.
+ */
+class RandomEngine {
+public:
+    using result_type = std::uint64_t;
+
+    virtual ~RandomEngine() = default;
+
+    static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    /**
+     * \brief generate the next random value
+     * @return 64 random bits
+     */
+    virtual result_type operator()() = 0;
+
+    /**
+     * \brief fill an array of 64 bit words with random values
+     * @param words destination
+     * @param count number of words
+     * @param mask bitmask that is applied to every generated word
+     */
+    virtual void fill(std::uint64_t *words, std::size_t count, std::uint64_t mask) = 0;
+
+    /**
+     * \brief reseed the engine
+     * @param seed new seed
+     */
+    virtual void seed(result_type seed) = 0;
+
+    /**
+     * \brief get the engine name (as it is used by the command line argument '--engine')
+     * @return engine name
+     */
+    [[nodiscard]] virtual const std::string &get_name() const noexcept = 0;
+};
+
+/**
+ * \brief RandomEngine implementation for a concrete generator
+ * @tparam Generator generator type
+ */
+template <typename Generator>
+class RandomEngineImpl final : public RandomEngine {
+private:
+    Generator   gen;
+    std::string name;
+
+public:
+    RandomEngineImpl(std::string name, std::uint64_t seed) : gen(seed), name(std::move(name)) {}
+
+    result_type operator()() override { return gen(); }
+
+    void fill(std::uint64_t *words, std::size_t count, std::uint64_t mask) override {
+        if constexpr (requires { gen.fill(words, count, mask); }) {
+            gen.fill(words, count, mask);
+        } else {
+            for (std::size_t i = 0; i < count; ++i)
+                words[i] = gen() & mask;  // NOLINT
+        }
+    }
+
+    void seed(result_type seed) override { gen.seed(seed); }
+
+    [[nodiscard]] const std::string &get_name() const noexcept override { return name; }
+
+    /**
+     * \brief get the concrete generator
+     * @details Used by the specialised fill kernels (see FillKernels) to call the generator without virtual dispatch.
+     * @return generator
+     */
+    Generator &generator() noexcept { return gen; }
+};
+
+/**
+ * \brief create a random engine by name
+ * @param name engine name (see engine_names())
+ * @param seed initial seed
+ * @return random engine
+ * @exception std::invalid_argument unknown engine name
+ */
+std::unique_ptr<RandomEngine> make_engine(const std::string &name, std::uint64_t seed);
+
+/**
+ * \brief get the names of all available engines
+ * @return engine names
+ */
+const std::vector<std::string> &engine_names();
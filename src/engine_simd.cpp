@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "engine_simd.hpp"
+
+#include "engine.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <immintrin.h>
+#    define SIMD_X86
+#elif defined(__aarch64__)
+#    include <arm_neon.h>
+#    define SIMD_NEON
+#endif
+
+using state_t = Xoshiro256x8::state_t;
+
+static constexpr std::size_t LANES = Xoshiro256x8::LANES;
+
+/**
+ * \brief portable kernel
+ */
+[[maybe_unused]] static void kernel_scalar(state_t &s, std::uint64_t *dst, std::size_t blocks, std::uint64_t mask) {
+    // NOLINTBEGIN
+    for (std::size_t b = 0; b < blocks; ++b) {
+        for (std::size_t l = 0; l < LANES; ++l) {
+            const std::uint64_t x = s[1][l] * 5;
+            const std::uint64_t r = ((x << 7U) | (x >> 57U)) * 9;
+            const std::uint64_t t = s[1][l] << 17U;
+
+            s[2][l] ^= s[0][l];
+            s[3][l] ^= s[1][l];
+            s[1][l] ^= s[2][l];
+            s[0][l] ^= s[3][l];
+            s[2][l] ^= t;
+            s[3][l] = (s[3][l] << 45U) | (s[3][l] >> 19U);
+
+            dst[b * LANES + l] = r & mask;
+        }
+    }
+    // NOLINTEND
+}
+
+#ifdef SIMD_X86
+/**
+ * \brief AVX2 kernel (two registers per state word)
+ */
+__attribute__((target("avx2"))) static void
+        kernel_avx2(state_t &s, std::uint64_t *dst, std::size_t blocks, std::uint64_t mask) {
+    static constexpr std::size_t HALF = LANES / 2;
+
+    // NOLINTBEGIN
+    __m256i s0[2] = {_mm256_load_si256(reinterpret_cast<const __m256i *>(s[0].data())),
+                     _mm256_load_si256(reinterpret_cast<const __m256i *>(s[0].data() + HALF))};
+    __m256i s1[2] = {_mm256_load_si256(reinterpret_cast<const __m256i *>(s[1].data())),
+                     _mm256_load_si256(reinterpret_cast<const __m256i *>(s[1].data() + HALF))};
+    __m256i s2[2] = {_mm256_load_si256(reinterpret_cast<const __m256i *>(s[2].data())),
+                     _mm256_load_si256(reinterpret_cast<const __m256i *>(s[2].data() + HALF))};
+    __m256i s3[2] = {_mm256_load_si256(reinterpret_cast<const __m256i *>(s[3].data())),
+                     _mm256_load_si256(reinterpret_cast<const __m256i *>(s[3].data() + HALF))};
+
+    const __m256i m = _mm256_set1_epi64x(static_cast<long long>(mask));
+
+    for (std::size_t b = 0; b < blocks; ++b) {
+        for (std::size_t h = 0; h < 2; ++h) {
+            // x * 5 == x + (x << 2), x * 9 == x + (x << 3)
+            __m256i x = _mm256_add_epi64(s1[h], _mm256_slli_epi64(s1[h], 2));
+            x         = _mm256_or_si256(_mm256_slli_epi64(x, 7), _mm256_srli_epi64(x, 57));
+            x         = _mm256_add_epi64(x, _mm256_slli_epi64(x, 3));
+
+            const __m256i t = _mm256_slli_epi64(s1[h], 17);
+            s2[h]           = _mm256_xor_si256(s2[h], s0[h]);
+            s3[h]           = _mm256_xor_si256(s3[h], s1[h]);
+            s1[h]           = _mm256_xor_si256(s1[h], s2[h]);
+            s0[h]           = _mm256_xor_si256(s0[h], s3[h]);
+            s2[h]           = _mm256_xor_si256(s2[h], t);
+            s3[h]           = _mm256_or_si256(_mm256_slli_epi64(s3[h], 45), _mm256_srli_epi64(s3[h], 19));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + b * LANES + h * HALF), _mm256_and_si256(x, m));
+        }
+    }
+
+    for (std::size_t h = 0; h < 2; ++h) {
+        _mm256_store_si256(reinterpret_cast<__m256i *>(s[0].data() + h * HALF), s0[h]);
+        _mm256_store_si256(reinterpret_cast<__m256i *>(s[1].data() + h * HALF), s1[h]);
+        _mm256_store_si256(reinterpret_cast<__m256i *>(s[2].data() + h * HALF), s2[h]);
+        _mm256_store_si256(reinterpret_cast<__m256i *>(s[3].data() + h * HALF), s3[h]);
+    }
+    // NOLINTEND
+}
+
+/**
+ * \brief AVX-512 kernel (one register per state word)
+ */
+__attribute__((target("avx512f"))) static void
+        kernel_avx512(state_t &s, std::uint64_t *dst, std::size_t blocks, std::uint64_t mask) {
+    // NOLINTBEGIN
+    __m512i s0 = _mm512_load_si512(s[0].data());
+    __m512i s1 = _mm512_load_si512(s[1].data());
+    __m512i s2 = _mm512_load_si512(s[2].data());
+    __m512i s3 = _mm512_load_si512(s[3].data());
+
+    const __m512i m = _mm512_set1_epi64(static_cast<long long>(mask));
+
+    for (std::size_t b = 0; b < blocks; ++b) {
+        __m512i x = _mm512_add_epi64(s1, _mm512_slli_epi64(s1, 2));
+        x         = _mm512_rol_epi64(x, 7);
+        x         = _mm512_add_epi64(x, _mm512_slli_epi64(x, 3));
+
+        const __m512i t = _mm512_slli_epi64(s1, 17);
+        s2              = _mm512_xor_si512(s2, s0);
+        s3              = _mm512_xor_si512(s3, s1);
+        s1              = _mm512_xor_si512(s1, s2);
+        s0              = _mm512_xor_si512(s0, s3);
+        s2              = _mm512_xor_si512(s2, t);
+        s3              = _mm512_rol_epi64(s3, 45);
+
+        _mm512_storeu_si512(dst + b * LANES, _mm512_and_si512(x, m));
+    }
+
+    _mm512_store_si512(s[0].data(), s0);
+    _mm512_store_si512(s[1].data(), s1);
+    _mm512_store_si512(s[2].data(), s2);
+    _mm512_store_si512(s[3].data(), s3);
+    // NOLINTEND
+}
+#endif
+
+#ifdef SIMD_NEON
+/**
+ * \brief NEON kernel (four registers per state word)
+ */
+static void kernel_neon(state_t &s, std::uint64_t *dst, std::size_t blocks, std::uint64_t mask) {
+    static constexpr std::size_t REGS = LANES / 2;
+
+    // NOLINTBEGIN
+    uint64x2_t s0[REGS], s1[REGS], s2[REGS], s3[REGS];
+    for (std::size_t r = 0; r < REGS; ++r) {
+        s0[r] = vld1q_u64(s[0].data() + 2 * r);
+        s1[r] = vld1q_u64(s[1].data() + 2 * r);
+        s2[r] = vld1q_u64(s[2].data() + 2 * r);
+        s3[r] = vld1q_u64(s[3].data() + 2 * r);
+    }
+
+    const uint64x2_t m = vdupq_n_u64(mask);
+
+    for (std::size_t b = 0; b < blocks; ++b) {
+        for (std::size_t r = 0; r < REGS; ++r) {
+            uint64x2_t x = vaddq_u64(s1[r], vshlq_n_u64(s1[r], 2));
+            x            = vorrq_u64(vshlq_n_u64(x, 7), vshrq_n_u64(x, 57));
+            x            = vaddq_u64(x, vshlq_n_u64(x, 3));
+
+            const uint64x2_t t = vshlq_n_u64(s1[r], 17);
+            s2[r]              = veorq_u64(s2[r], s0[r]);
+            s3[r]              = veorq_u64(s3[r], s1[r]);
+            s1[r]              = veorq_u64(s1[r], s2[r]);
+            s0[r]              = veorq_u64(s0[r], s3[r]);
+            s2[r]              = veorq_u64(s2[r], t);
+            s3[r]              = vorrq_u64(vshlq_n_u64(s3[r], 45), vshrq_n_u64(s3[r], 19));
+
+            vst1q_u64(dst + b * LANES + 2 * r, vandq_u64(x, m));
+        }
+    }
+
+    for (std::size_t r = 0; r < REGS; ++r) {
+        vst1q_u64(s[0].data() + 2 * r, s0[r]);
+        vst1q_u64(s[1].data() + 2 * r, s1[r]);
+        vst1q_u64(s[2].data() + 2 * r, s2[r]);
+        vst1q_u64(s[3].data() + 2 * r, s3[r]);
+    }
+    // NOLINTEND
+}
+#endif
+
+/**
+ * \brief kernel that is used on this machine
+ */
+struct Kernel {
+    Xoshiro256x8::kernel_t function;
+    const char            *name;
+};
+
+/**
+ * \brief select the best kernel for this machine
+ * @return selected kernel
+ */
+static const Kernel &get_kernel() noexcept {
+    static const Kernel KERNEL = []() -> Kernel {
+#ifdef SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return {kernel_avx512, "avx512"};
+        if (__builtin_cpu_supports("avx2")) return {kernel_avx2, "avx2"};
+#endif
+#ifdef SIMD_NEON
+        return {kernel_neon, "neon"};
+#else
+        return {kernel_scalar, "scalar"};
+#endif
+    }();
+    return KERNEL;
+}
+
+Xoshiro256x8::Xoshiro256x8(result_type seed) noexcept : kernel(get_kernel().function) {
+    this->seed(seed);
+}
+
+void Xoshiro256x8::seed(result_type seed) noexcept {
+    // every lane is seeded with its own splitmix64 outputs (no jumps: the reproducible mode reseeds every block)
+    SplitMix64 sm(seed);
+    for (std::size_t l = 0; l < LANES; ++l) {
+        for (auto &word : state)
+            word[l] = sm();  // NOLINT
+    }
+    buffer_pos = LANES;
+}
+
+void Xoshiro256x8::fill(std::uint64_t *words, std::size_t count, std::uint64_t mask) noexcept {
+    // use remaining buffered values first
+    while (count && buffer_pos < LANES) {
+        *words++ = buffer[buffer_pos++] & mask;  // NOLINT
+        --count;
+    }
+
+    const auto blocks = count / LANES;
+    if (blocks) kernel(state, words, blocks, mask);
+
+    const auto remaining = count % LANES;
+    if (remaining) {
+        kernel(state, buffer.data(), 1, ~result_type {0});
+        for (std::size_t i = 0; i < remaining; ++i)
+            words[blocks * LANES + i] = buffer[i] & mask;  // NOLINT
+        buffer_pos = remaining;
+    }
+}
+
+const char *Xoshiro256x8::kernel_name() noexcept {
+    return get_kernel().name;
+}
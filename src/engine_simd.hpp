@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/**
+ * \brief 8 interleaved xoshiro256** streams
+ * @details The streams are stored as structure of arrays, so that every state word of all streams fits into one
+ *          AVX-512 register (two AVX2 or four NEON registers).
+ *          The kernel is selected once at startup, depending on the features of the CPU.
+ *          The generated values are identical for all kernels.
+ */
+class Xoshiro256x8 {
+public:
+    using result_type = std::uint64_t;
+
+    //* number of interleaved streams
+    static constexpr std::size_t LANES = 8;
+
+    //* state of all streams (state[word][lane])
+    using state_t = std::array<std::array<result_type, LANES>, 4>;
+
+    /**
+     * \brief fill function of a kernel
+     * @details generates blocks * LANES words
+     */
+    using kernel_t = void (*)(state_t &state, std::uint64_t *dst, std::size_t blocks, std::uint64_t mask);
+
+private:
+    alignas(64) state_t state {};
+    alignas(64) std::array<result_type, LANES> buffer {};
+    std::size_t buffer_pos = LANES;
+    kernel_t    kernel;
+
+public:
+    explicit Xoshiro256x8(result_type seed) noexcept;
+
+    /**
+     * \brief reseed all streams
+     * @details The streams are seeded with consecutive splitmix64 outputs (4 words per stream).
+     *          This is much cheaper than jumping the streams 2^128 steps apart, which matters because the reproducible
+     *          mode reseeds the engine at every block. Overlapping streams are practically impossible (period 2^256).
+     * @param seed
+     */
+    void seed(result_type seed) noexcept;
+
+    static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() noexcept {
+        if (buffer_pos == LANES) {
+            kernel(state, buffer.data(), 1, ~result_type {0});
+            buffer_pos = 0;
+        }
+        return buffer[buffer_pos++];  // NOLINT
+    }
+
+    /**
+     * \brief fill an array of 64 bit words with random values
+     * @param words destination
+     * @param count number of words
+     * @param mask bitmask that is applied to every generated word
+     */
+    void fill(std::uint64_t *words, std::size_t count, std::uint64_t mask) noexcept;
+
+    /**
+     * \brief get the name of the kernel that is used on this machine
+     * @return kernel name (avx512, avx2, neon or scalar)
+     */
+    static const char *kernel_name() noexcept;
+};
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "fill.hpp"
+
+#include "engine_simd.hpp"
+#include "stream.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+static constexpr std::size_t WORD_SIZE = sizeof(std::uint64_t);
+
+//* alignment of the streaming stores
+static constexpr std::size_t STREAM_ALIGNMENT = 64;
+
+//* number of words that are generated at once by fill_random_stream (fits into the L1 cache)
+static constexpr std::size_t STREAM_BUFFER_WORDS = 512;
+
+LaneMask::LaneMask(std::uint64_t bitmask, std::size_t alignment) {
+    switch (alignment) {
+        case 1: {
+            const auto tmp = static_cast<std::uint8_t>(bitmask);
+            for (std::size_t i = 0; i < pattern.size(); i += sizeof(tmp))
+                std::memcpy(pattern.data() + i, &tmp, sizeof(tmp));
+            break;
+        }
+        case 2: {  // NOLINT
+            const auto tmp = static_cast<std::uint16_t>(bitmask);
+            for (std::size_t i = 0; i < pattern.size(); i += sizeof(tmp))
+                std::memcpy(pattern.data() + i, &tmp, sizeof(tmp));
+            break;
+        }
+        case 4: {  // NOLINT
+            const auto tmp = static_cast<std::uint32_t>(bitmask);
+            for (std::size_t i = 0; i < pattern.size(); i += sizeof(tmp))
+                std::memcpy(pattern.data() + i, &tmp, sizeof(tmp));
+            break;
+        }
+        case 8: {  // NOLINT
+            for (std::size_t i = 0; i < pattern.size(); i += sizeof(bitmask))
+                std::memcpy(pattern.data() + i, &bitmask, sizeof(bitmask));
+            break;
+        }
+        default: throw std::invalid_argument("invalid alignment: " + std::to_string(alignment));
+    }
+}
+
+std::uint64_t LaneMask::get(std::size_t byte_offset) const noexcept {
+    // the pattern is periodic with the alignment, which is a divisor of the word size
+    std::uint64_t mask = 0;
+    std::memcpy(&mask, pattern.data() + byte_offset % WORD_SIZE, sizeof(mask));
+    return mask;
+}
+
+bool LaneMask::is_full() const noexcept {
+    return std::all_of(pattern.begin(), pattern.end(), [](std::uint8_t x) { return x == 0xFF; });  // NOLINT
+}
+
+/**
+ * \brief get the concrete generator of an engine
+ * @tparam Generator generator type (RandomEngine: virtual interface)
+ */
+template <typename Generator>
+static inline Generator &generator(RandomEngine &engine) noexcept {
+    if constexpr (std::is_same_v<Generator, RandomEngine>) return engine;
+    else return static_cast<RandomEngineImpl<Generator> &>(engine).generator();
+}
+
+/**
+ * \brief generate an array of 64 bit words
+ * @tparam MASKED apply the mask
+ */
+template <bool MASKED, typename Generator>
+static inline void generate_words(Generator &gen, std::uint64_t *words, std::size_t count, std::uint64_t mask) {
+    if constexpr (requires { gen.fill(words, count, mask); }) {
+        gen.fill(words, count, MASKED ? mask : ~std::uint64_t {0});
+    } else {
+        for (std::size_t i = 0; i < count; ++i) {
+            if constexpr (MASKED) words[i] = gen() & mask;  // NOLINT
+            else words[i] = gen();                          // NOLINT
+        }
+    }
+}
+
+/**
+ * \brief write less than one word of random data
+ * @param data destination
+ * @param size number of bytes (< word size)
+ * @param mask word mask
+ * @param gen random generator
+ */
+template <bool MASKED, typename Generator>
+static inline void write_partial(std::uint8_t *data, std::size_t size, std::uint64_t mask, Generator &gen) {
+    std::uint64_t value = gen();
+    if constexpr (MASKED) value &= mask;
+    std::memcpy(data, &value, size);
+}
+
+template <bool MASKED, typename Generator>
+static void fill_cached(
+        std::uint8_t *bytes, std::size_t size, const LaneMask &mask, Generator &gen, std::size_t mask_offset) {
+    std::size_t pos = 0;
+
+    const auto misalignment = reinterpret_cast<std::uintptr_t>(bytes) % WORD_SIZE;  // NOLINT
+    if (misalignment) {
+        pos = std::min(size, WORD_SIZE - misalignment);
+        write_partial<MASKED>(bytes, pos, mask.get(mask_offset), gen);
+    }
+
+    const auto words = (size - pos) / WORD_SIZE;
+    if (words) {
+        auto *dst = reinterpret_cast<std::uint64_t *>(bytes + pos);  // NOLINT
+        generate_words<MASKED>(gen, dst, words, mask.get(mask_offset + pos));
+    }
+    pos += words * WORD_SIZE;
+
+    if (pos < size) write_partial<MASKED>(bytes + pos, size - pos, mask.get(mask_offset + pos), gen);
+}
+
+template <bool MASKED, typename Generator>
+static void fill_stream(
+        std::uint8_t *bytes, std::size_t size, const LaneMask &mask, Generator &gen, std::size_t mask_offset) {
+    std::size_t pos = 0;
+
+    // head: normal stores up to the first 64 byte boundary
+    const auto misalignment = reinterpret_cast<std::uintptr_t>(bytes) % STREAM_ALIGNMENT;  // NOLINT
+    if (misalignment) {
+        pos = std::min(size, STREAM_ALIGNMENT - misalignment);
+        fill_cached<MASKED>(bytes, pos, mask, gen, mask_offset);
+    }
+
+    // body: generate into the buffer, stream to the destination (both 64 byte aligned)
+    alignas(STREAM_ALIGNMENT) std::array<std::uint64_t, STREAM_BUFFER_WORDS> buffer;
+    const auto word_mask = mask.get(mask_offset + pos);
+    auto       blocks    = (size - pos) / STREAM_ALIGNMENT;
+    while (blocks) {
+        const auto words = std::min(blocks * (STREAM_ALIGNMENT / WORD_SIZE), buffer.size());
+        generate_words<MASKED>(gen, buffer.data(), words, word_mask);
+        stream_copy(bytes + pos, buffer.data(), words * WORD_SIZE);
+        pos += words * WORD_SIZE;
+        blocks -= words / (STREAM_ALIGNMENT / WORD_SIZE);
+    }
+
+    if (pos < size) fill_cached<MASKED>(bytes + pos, size - pos, mask, gen, mask_offset + pos);
+}
+
+void fill_random(void *data, std::size_t size, const LaneMask &mask, RandomEngine &engine, std::size_t mask_offset) {
+    fill_cached<true>(static_cast<std::uint8_t *>(data), size, mask, engine, mask_offset);
+}
+
+void fill_random_stream(
+        void *data, std::size_t size, const LaneMask &mask, RandomEngine &engine, std::size_t mask_offset) {
+    fill_stream<true>(static_cast<std::uint8_t *>(data), size, mask, engine, mask_offset);
+}
+
+template <typename Generator, bool MASKED, bool STREAM>
+static void fill_kernel(
+        void *data, std::size_t size, const LaneMask &mask, RandomEngine &engine, std::size_t mask_offset) {
+    auto *bytes = static_cast<std::uint8_t *>(data);
+    auto &gen   = generator<Generator>(engine);
+    if constexpr (STREAM) fill_stream<MASKED>(bytes, size, mask, gen, mask_offset);
+    else fill_cached<MASKED>(bytes, size, mask, gen, mask_offset);
+}
+
+//* kernels of one generator (index: masked * 2 + stream)
+template <typename Generator>
+static constexpr std::array<fill_kernel_t, 4> KERNELS {fill_kernel<Generator, false, false>,
+                                                       fill_kernel<Generator, false, true>,
+                                                       fill_kernel<Generator, true, false>,
+                                                       fill_kernel<Generator, true, true>};
+
+/**
+ * \brief select the kernels of the engine type
+ * @return kernels of the first matching generator, generic kernels if no generator matches
+ */
+template <typename Generator, typename... Generators>
+static const std::array<fill_kernel_t, 4> &select_kernels(const RandomEngine &engine) noexcept {
+    if (dynamic_cast<const RandomEngineImpl<Generator> *>(&engine)) return KERNELS<Generator>;
+    if constexpr (sizeof...(Generators) != 0) return select_kernels<Generators...>(engine);
+    else return KERNELS<RandomEngine>;
+}
+
+FillKernels::FillKernels() noexcept : table(KERNELS<RandomEngine>) {}
+
+FillKernels::FillKernels(const RandomEngine &engine) noexcept
+    : table(select_kernels<Xoshiro256x8, Xoshiro256ss, WyRand, SplitMix64, PCG64, MT19937_64, Minstd>(engine)) {}
+
+bool FillKernels::is_specialised() const noexcept { return table != KERNELS<RandomEngine>; }
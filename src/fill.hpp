@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "engine.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * \brief element bitmask, replicated to all elements of a 64 bit word
+ * @details The bitmask is stored in memory order, so the replicated mask is independent of the host endianness.
+ */
+class LaneMask {
+private:
+    static constexpr std::size_t WORD_SIZE = sizeof(std::uint64_t);
+
+    std::array<std::uint8_t, 2 * WORD_SIZE> pattern {};
+
+public:
+    /**
+     * \brief create lane mask
+     * @param bitmask element bitmask (only the lower alignment * 8 bits are used)
+     * @param alignment element size in bytes (1, 2, 4 or 8)
+     */
+    LaneMask(std::uint64_t bitmask, std::size_t alignment);
+
+    /**
+     * \brief get the mask for a 64 bit word
+     * @param byte_offset offset of the word (in bytes) relative to the start of the memory area
+     * @return word mask
+     */
+    [[nodiscard]] std::uint64_t get(std::size_t byte_offset) const noexcept;
+
+    /**
+     * \brief check if the mask has no effect
+     * @return true if all bits are set
+     */
+    [[nodiscard]] bool is_full() const noexcept;
+};
+
+/**
+ * \brief fill memory area with random data
+ * @details The memory area is filled with 64 bit words that are written directly by the engine.
+ *          Only the (unaligned) head and tail of the memory area are written byte wise.
+ *
+ * @param data pointer to memory area
+ * @param size size of the memory area in bytes
+ * @param mask bitmask that is applied to the generated random values
+ * @param engine random engine that is used to generate the random values
+ * @param mask_offset offset of data (in bytes) relative to the start of the memory area the mask refers to
+ */
+void fill_random(
+        void *data, std::size_t size, const LaneMask &mask, RandomEngine &engine, std::size_t mask_offset = 0);
+
+/**
+ * \brief fill memory area with random data using non-temporal (streaming) stores
+ * @details The random values are generated into a small, cache resident buffer and copied to the memory area with
+ *          streaming stores (see stream_copy). This avoids the read for ownership and the eviction of the working
+ *          set of the application if the memory area is larger than the last level cache.
+ *          The head and tail of the memory area (up to the next 64 byte boundary) are written with normal stores.
+ *
+ *          The streaming stores are weakly ordered: stream_fence() has to be called by the same thread before the
+ *          data is published (e.g. semaphore post).
+ *
+ * @param data pointer to memory area
+ * @param size size of the memory area in bytes
+ * @param mask bitmask that is applied to the generated random values
+ * @param engine random engine that is used to generate the random values
+ * @param mask_offset offset of data (in bytes) relative to the start of the memory area the mask refers to
+ */
+void fill_random_stream(
+        void *data, std::size_t size, const LaneMask &mask, RandomEngine &engine, std::size_t mask_offset = 0);
+
+/**
+ * \brief fill function that is specialised for one engine, mask mode and store type
+ * @details Same semantics as fill_random / fill_random_stream.
+ *          The engine has to be an engine of the type the kernel was selected for (see FillKernels).
+ */
+using fill_kernel_t = void (*)(
+        void *data, std::size_t size, const LaneMask &mask, RandomEngine &engine, std::size_t mask_offset);
+
+/**
+ * \brief dispatch table of the fill kernels
+ * @details The kernels are instantiated at compile time for every combination of engine, mask mode (no mask,
+ *          constant mask) and store type (cached, streaming). The concrete generator is called directly, so the
+ *          inner loops contain no virtual calls and no mask operation if the mask has no effect.
+ *          The element width does not need its own kernels: the mask is replicated to 64 bit words (see LaneMask).
+ *
+ *          The engine is resolved once when the table is created, only the table lookup remains per fill.
+ */
+class FillKernels {
+private:
+    std::array<fill_kernel_t, 4> table;
+
+public:
+    /**
+     * \brief create table with the generic kernels
+     * @details The generic kernels use the virtual interface of RandomEngine and work with every engine.
+     */
+    FillKernels() noexcept;
+
+    /**
+     * \brief create table with the kernels for the type of an engine
+     * @details Falls back to the generic kernels if the engine type is unknown.
+     * @param engine random engine (all engines the kernels are used with must be of the same type)
+     */
+    explicit FillKernels(const RandomEngine &engine) noexcept;
+
+    /**
+     * \brief get a kernel
+     * @param masked the mask has an effect (see LaneMask::is_full)
+     * @param stream use streaming stores
+     * @return fill kernel
+     */
+    [[nodiscard]] fill_kernel_t get(bool masked, bool stream) const noexcept {
+        return table[(masked ? 2U : 0U) + (stream ? 1U : 0U)];  // NOLINT
+    }
+
+    /**
+     * \brief check if the kernels are specialised for the engine type
+     * @return false if the generic kernels are used
+     */
+    [[nodiscard]] bool is_specialised() const noexcept;
+};
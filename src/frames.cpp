@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "frames.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+static constexpr std::size_t OFFSET_VERSION     = 8;
+static constexpr std::size_t OFFSET_FRAMES      = 12;
+static constexpr std::size_t OFFSET_FRAME_SIZE  = 16;
+static constexpr std::size_t OFFSET_STRIDE      = 24;
+static constexpr std::size_t OFFSET_PUBLICATION = 32;
+
+static constexpr unsigned GENERATION_SHIFT = 32;
+
+/**
+ * \brief index of the frame that follows the current one (frame 0 if no frame was published yet)
+ */
+static constexpr std::uint32_t next_of(std::uint32_t current, std::uint32_t frames) noexcept {
+    return current == FrameRing::NO_FRAME ? 0 : (current + 1) % frames;
+}
+
+/**
+ * \brief round frame size up to the frame alignment
+ */
+static constexpr std::size_t stride_of(std::size_t frame_size) noexcept {
+    return (frame_size + FrameRing::FRAME_ALIGNMENT - 1) / FrameRing::FRAME_ALIGNMENT * FrameRing::FRAME_ALIGNMENT;
+}
+
+/**
+ * \brief compute the size of a frame layout (header and all frames)
+ * @return false: the size does not fit into std::size_t
+ */
+static bool layout_size(std::size_t frame_size, std::uint32_t frames, std::size_t &size) noexcept {
+    if (frame_size > SIZE_MAX - (FrameRing::FRAME_ALIGNMENT - 1)) return false;
+    return !__builtin_mul_overflow(stride_of(frame_size), std::size_t {frames}, &size) &&
+           !__builtin_add_overflow(size, FrameRing::HEADER_SIZE, &size);
+}
+
+std::size_t FrameRing::required_size(std::size_t frame_size, std::uint32_t frames) {
+    std::size_t size = 0;
+    if (!layout_size(frame_size, frames, size))
+        throw std::invalid_argument("a layout with " + std::to_string(frames) + " frames of " +
+                                    std::to_string(frame_size) + " bytes is to large");
+    return size;
+}
+
+void FrameRing::initialize(void *shm, std::size_t shm_size, std::size_t frame_size, std::uint32_t frames) {
+    if (frames < 2) throw std::invalid_argument("at least 2 frames are required");
+    if (frame_size == 0) throw std::invalid_argument("frame size must not be 0");
+    if (required_size(frame_size, frames) > shm_size)
+        throw std::invalid_argument("shared memory is to small for " + std::to_string(frames) + " frames");
+
+    auto               *header = static_cast<std::uint8_t *>(shm);
+    const std::uint64_t size   = frame_size;
+    const std::uint64_t stride = stride_of(frame_size);
+
+    std::memset(header, 0, HEADER_SIZE);
+    std::memcpy(header, MAGIC.data(), MAGIC.size());
+    std::memcpy(header + OFFSET_VERSION, &VERSION, sizeof(VERSION));
+    std::memcpy(header + OFFSET_FRAMES, &frames, sizeof(frames));
+    std::memcpy(header + OFFSET_FRAME_SIZE, &size, sizeof(size));
+    std::memcpy(header + OFFSET_STRIDE, &stride, sizeof(stride));
+
+    // nothing is published until the first frame (frame 0) is filled
+    std::atomic_ref<std::uint64_t> publication(*reinterpret_cast<std::uint64_t *>(header + OFFSET_PUBLICATION));  // NOLINT
+    publication.store(NO_FRAME, std::memory_order_release);
+}
+
+FrameRing::FrameRing(void *shm, std::size_t shm_size)
+    : base(static_cast<std::uint8_t *>(shm)),
+      publication(reinterpret_cast<std::uint64_t *>(base + OFFSET_PUBLICATION)) {  // NOLINT
+    if (shm_size < HEADER_SIZE || std::memcmp(base, MAGIC.data(), MAGIC.size()) != 0)
+        throw std::runtime_error("shared memory does not contain a frame header");
+
+    std::uint32_t version = 0;
+    std::uint64_t size    = 0;
+    std::uint64_t stride  = 0;
+    std::memcpy(&version, base + OFFSET_VERSION, sizeof(version));
+    std::memcpy(&frames, base + OFFSET_FRAMES, sizeof(frames));
+    std::memcpy(&size, base + OFFSET_FRAME_SIZE, sizeof(size));
+    std::memcpy(&stride, base + OFFSET_STRIDE, sizeof(stride));
+
+    if (version != VERSION) throw std::runtime_error("unsupported frame header version " + std::to_string(version));
+
+    frame_size   = size;
+    frame_stride = stride;
+
+    std::size_t required = 0;
+    if (frames < 2 || frame_size == 0 || !layout_size(frame_size, frames, required) ||
+        frame_stride != stride_of(frame_size) || required > shm_size)
+        throw std::runtime_error("invalid frame header");
+}
+
+std::uint8_t *FrameRing::back_frame() const noexcept {
+    std::atomic_ref<std::uint64_t> pub(*publication);
+    const auto current = static_cast<std::uint32_t>(pub.load(std::memory_order_relaxed));
+    return base + HEADER_SIZE + frame_stride * next_of(current, frames);
+}
+
+void FrameRing::end() {
+    std::atomic_ref<std::uint64_t> pub(*publication);
+    const auto                     value      = pub.load(std::memory_order_relaxed);
+    const auto                     current    = static_cast<std::uint32_t>(value);
+    const auto                     generation = value >> GENERATION_SHIFT;
+
+    const std::uint64_t next = next_of(current, frames);
+    pub.store(((generation + 1) << GENERATION_SHIFT) | next, std::memory_order_release);
+}
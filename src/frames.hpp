@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "sync.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * \brief shared memory layout with multiple frames and an atomically published frame index
+ * @details Layout of the shared memory (all values in native endianness):
+ *
+ *     offset | size | content
+ *     -------|------|----------------------------------------------------------
+ *          0 |    8 | magic "SMRFRAME"
+ *          8 |    4 | layout version (1)
+ *         12 |    4 | number of frames (N)
+ *         16 |    8 | frame size in bytes
+ *         24 |    8 | frame stride in bytes (frame size rounded up to 64)
+ *         32 |    8 | publication word: bits 0..31 current frame index, bits 32..63 generation
+ *            |      | (index 0xffffffff: no frame published yet)
+ *         40 |   24 | reserved
+ *         64 |  ... | N frames (frame i at 64 + i * stride)
+ *
+ *          The writer fills the frame after the current one and publishes it with a single release store of the
+ *          publication word.
+ *
+ *          Until the first frame is filled, the frame index is NO_FRAME (0xffffffff) and the generation is 0.
+ *          Readers load the publication word (acquire) and read the current frame.
+ *          The frame stays untouched as long as the generation advanced by less than N - 1.
+ *          Readers that need to detect this can load the publication word again after reading the frame.
+ */
+class FrameRing final : public FrameSync {
+public:
+    //* size of the header
+    static constexpr std::size_t HEADER_SIZE = 64;
+
+    //* frames are aligned to this size
+    static constexpr std::size_t FRAME_ALIGNMENT = 64;
+
+    //* layout version
+    static constexpr std::uint32_t VERSION = 1;
+
+    //* frame index of the publication word before the first frame is published
+    static constexpr std::uint32_t NO_FRAME = 0xffffffff;
+
+    //* magic value at the start of the header
+    static constexpr std::array<char, 8> MAGIC {'S', 'M', 'R', 'F', 'R', 'A', 'M', 'E'};
+
+private:
+    std::uint8_t  *base;
+    std::uint64_t *publication;
+    std::uint32_t  frames;
+    std::size_t    frame_size;
+    std::size_t    frame_stride;
+
+public:
+    /**
+     * \brief attach to a shared memory that contains a frame header
+     * @param shm address of the shared memory
+     * @param shm_size size of the shared memory in bytes
+     * @exception std::runtime_error no valid frame header or shared memory to small
+     */
+    FrameRing(void *shm, std::size_t shm_size);
+
+    /**
+     * \brief write a new frame header
+     * @param shm address of the shared memory
+     * @param shm_size size of the shared memory in bytes
+     * @param frame_size size of one frame in bytes
+     * @param frames number of frames (>= 2)
+     * @exception std::invalid_argument invalid number of frames or shared memory to small
+     */
+    static void initialize(void *shm, std::size_t shm_size, std::size_t frame_size, std::uint32_t frames);
+
+    /**
+     * \brief get the shared memory size that is required for a frame layout
+     * @param frame_size size of one frame in bytes
+     * @param frames number of frames
+     * @return required size in bytes
+     * @exception std::invalid_argument the required size does not fit into std::size_t
+     */
+    static std::size_t required_size(std::size_t frame_size, std::uint32_t frames);
+
+    /**
+     * \brief get the frame that is written next
+     * @return address of the back frame
+     */
+    [[nodiscard]] std::uint8_t *back_frame() const noexcept;
+
+    /**
+     * \brief get the frame size
+     * @return frame size in bytes
+     */
+    [[nodiscard]] std::size_t get_frame_size() const noexcept { return frame_size; }
+
+    /**
+     * \brief get the number of frames
+     * @return number of frames
+     */
+    [[nodiscard]] std::uint32_t get_frames() const noexcept { return frames; }
+
+    bool begin() override { return true; }
+
+    /**
+     * \brief publish the back frame
+     */
+    void end() override;
+};
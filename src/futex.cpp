@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "futex.hpp"
+
+#include <cerrno>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static constexpr long NS_PER_S = 1000000000;
+
+bool futex_wait(std::uint32_t *word, std::uint32_t expected, std::optional<std::chrono::nanoseconds> timeout) noexcept {
+    timespec  relative {};
+    timespec *time = nullptr;
+    if (timeout) {
+        relative = {timeout->count() / NS_PER_S, timeout->count() % NS_PER_S};
+        time     = &relative;
+    }
+
+    // EAGAIN: the word was changed before the thread went to sleep, EINTR: signal
+    if (syscall(SYS_futex, word, FUTEX_WAIT, expected, time, nullptr, 0) == -1) return errno != ETIMEDOUT;
+    return true;
+}
+
+int futex_wake(std::uint32_t *word, int count) noexcept {
+    const auto woken = syscall(SYS_futex, word, FUTEX_WAKE, count, nullptr, nullptr, 0);
+    return woken == -1 ? 0 : static_cast<int>(woken);
+}
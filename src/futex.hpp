@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+/**
+ * \brief wait on a futex word in shared memory
+ * @details Uses the shared (non private) futex operations, so the word can be waited on and woken by different
+ *          processes that map the same memory.
+ * @param word futex word (4 byte aligned)
+ * @param expected the thread only sleeps if the word still contains this value
+ * @param timeout maximum wait (std::nullopt: forever)
+ * @return false on timeout
+ */
+bool futex_wait(std::uint32_t *word, std::uint32_t expected, std::optional<std::chrono::nanoseconds> timeout) noexcept;
+
+/**
+ * \brief wake threads that wait on a futex word in shared memory
+ * @param word futex word (4 byte aligned)
+ * @param count maximum number of threads that are woken
+ * @return number of woken threads
+ */
+int futex_wake(std::uint32_t *word, int count) noexcept;
@@ -104,29 +104,4 @@ void print_licenses(std::ostream &o) {
     o << "    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM," << '\n';
     o << "    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN" << '\n';
     o << "    THE SOFTWARE." << '\n';
-    o << '\n';
-    o << '\n';
-    o << "cxxitimer Library (https://github.com/NikolasK-source/cxxitimer)" << '\n';
-    o << '\n';
-    o << "    MIT License" << '\n';
-    o << '\n';
-    o << "    Copyright (c) 2022 Nikolas Koesling" << '\n';
-    o << '\n';
-    o << "    Permission is hereby granted, free of charge, to any person obtaining a copy" << '\n';
-    o << "    of this software and associated documentation files (the \"Software\"), to deal" << '\n';
-    o << "    in the Software without restriction, including without limitation the rights" << '\n';
-    o << "    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell" << '\n';
-    o << "    copies of the Software, and to permit persons to whom the Software is" << '\n';
-    o << "    furnished to do so, subject to the following conditions:" << '\n';
-    o << '\n';
-    o << "    The above copyright notice and this permission notice shall be included in" << '\n';
-    o << "    all copies or substantial portions of the Software." << '\n';
-    o << '\n';
-    o << "    THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR" << '\n';
-    o << "    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY," << '\n';
-    o << "    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE" << '\n';
-    o << "    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER" << '\n';
-    o << "    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM," << '\n';
-    o << "    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN" << '\n';
-    o << "    THE SOFTWARE." << '\n';
 }
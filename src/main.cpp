@@ -3,12 +3,37 @@
  * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
  */
 
+#include "benchmark.hpp"
+#include "buffer.hpp"
+#include "distribution.hpp"
+#include "engine.hpp"
+#include "engine_simd.hpp"
+#include "fill.hpp"
+#include "frames.hpp"
 #include "generated/version_info.hpp"
 #include "license.hpp"
+#include "memory.hpp"
+#include "parallel_fill.hpp"
+#include "perf_counters.hpp"
+#include "rate.hpp"
+#include "recorder.hpp"
+#include "region.hpp"
+#include "replay.hpp"
+#include "scheduler.hpp"
+#include "segments.hpp"
+#include "shm_watch.hpp"
+#include "stats.hpp"
+#include "stream.hpp"
+#include "stripe_lock.hpp"
+#include "sync.hpp"
+#include "update_window.hpp"
 
 #include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <chrono>
 #include <csignal>
-#include <cxxitimer.hpp>
 #include <cxxopts.hpp>
 #include <cxxsemaphore.hpp>
 #include <cxxshm.hpp>
@@ -16,63 +41,238 @@
 #include <filesystem>
 #include <iostream>
 #include <memory>
-#include <random>
+#include <optional>
 #include <sys/ioctl.h>
 #include <sysexits.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <vector>
 
-static constexpr std::size_t MAX_SEM_ERROR     = 1000;
-static constexpr std::size_t SEM_ERROR_INC     = 100;
-static std::size_t           sem_error_counter = 0;  // NOLINT
 
-static volatile bool terminate = false;  // NOLINT
+/*! \brief fill memory area with random data
+ *
+ * @param data pointer to memory area
+ * @param size size of the data area in bytes
+ * @param mask bitmask that is applied to the generated random values
+ * @param filler (multi threaded) random data generator
+ * @param sync synchronization with the readers of the shared memory (nullptr: no synchronization)
+ * @param stats runtime statistics (nullptr: no statistics)
+ * @return false if the frame was skipped (see FrameSync::begin)
+ */
+inline bool random_data(void           *data,
+                        std::size_t     size,
+                        const LaneMask &mask,
+                        ParallelFill   &filler,
+                        FrameSync      *sync,
+                        StatsExport    *stats) {
+    FillProbe probe(stats);
+    if (sync && !sync->begin()) return false;
+    probe.synced();
 
-static void sig_term_handler(int) {
-    terminate = true;
+    filler.fill(data, size, mask);
+
+    if (sync) sync->end();
+    probe.finish(StatsData::PERF_FILL, size);
+    return true;
 }
 
-static std::random_device         rd;        // NOLINT
-static std::default_random_engine re(rd());  // NOLINT
+/*! \brief fill memory area with random data stripe by stripe
+ *
+ * @param data pointer to memory area
+ * @param size size of the data area in bytes
+ * @param mask bitmask that is applied to the generated random values
+ * @param filler (multi threaded) random data generator
+ * @param locks lock table of the memory area
+ * @param timeout maximum wait for the locks of all stripes (std::nullopt: forever)
+ * @param stats runtime statistics (nullptr: no statistics)
+ * @return number of skipped stripes
+ */
+inline std::size_t striped_random_data(void                                   *data,
+                                       std::size_t                             size,
+                                       const LaneMask                         &mask,
+                                       ParallelFill                           &filler,
+                                       StripeLocks                            &locks,
+                                       std::optional<std::chrono::nanoseconds> timeout,
+                                       StatsExport                            *stats) {
+    FillProbe probe(stats);
+    probe.synced();
+    const auto skipped = filler.fill_striped(data, size, mask, locks, timeout);
 
+    // the lock waits are part of the write time
+    probe.finish(StatsData::PERF_FILL, size);
+    return skipped;
+}
 
-/*! \brief fill memory area with random data
+/*! \brief copy pre generated random data to the memory area
+ *
+ * @details Only the copy is done while the semaphore is held.
+ *          The next frame is generated afterwards, between two intervals.
  *
- * @tparam T element type
  * @param data pointer to memory area
- * @param elements number of elements in the data area
- * @param bitmask bitmask that is applied to the generated random values
+ * @param buffer buffer that contains the pre generated frame
+ * @param mask bitmask that is applied to the generated random values
+ * @param filler (multi threaded) random data generator
+ * @param sync synchronization with the readers of the shared memory (nullptr: no synchronization)
+ * @param stats runtime statistics (nullptr: no statistics)
+ * @return false if the frame was skipped (see FrameSync::begin)
  */
-template <typename T>
-inline void random_data(void                                     *data,
-                        std::size_t                               elements,  // NOLINT
-                        std::size_t                               bitmask,   // NOLINT
-                        std::unique_ptr<cxxsemaphore::Semaphore> &semaphore,
-                        const timespec                            semaphore_max_time) {
-    static_assert(sizeof(T) <= sizeof(bitmask), "must be compiled as 64 bit application.");
-    static std::uniform_int_distribution<T> dist(0, std::numeric_limits<T>::max());
-
-    if (semaphore) {
-        if (semaphore_max_time.tv_sec == 0 && semaphore_max_time.tv_nsec == 0) {
-            semaphore->wait();
-        } else {
-            if (!semaphore->wait(semaphore_max_time)) {
-                std::cerr << " WARNING: Failed to acquire semaphore '" << semaphore->get_name()
-                          << "' within a half intervall" << '\n';
-                sem_error_counter += SEM_ERROR_INC;
-                if (sem_error_counter >= MAX_SEM_ERROR) {
-                    std::cerr << "ERROR: acquiring semaphore failed to often. Terminating...";
-                    terminate = true;
-                }
-            } else {
-                if (sem_error_counter) --sem_error_counter;
-            }
+inline bool prebuffered_random_data(void                *data,
+                                    const PrivateBuffer &buffer,
+                                    const LaneMask      &mask,
+                                    ParallelFill        &filler,
+                                    FrameSync           *sync,
+                                    StatsExport         *stats) {
+    FillProbe probe(stats);
+    if (sync && !sync->begin()) return false;
+    probe.synced();
+
+    filler.copy(data, buffer.get_addr(), buffer.get_size());
+
+    if (sync) sync->end();
+    probe.finish(StatsData::PERF_COPY, buffer.get_size());
+
+    filler.fill(buffer.get_addr(), buffer.get_size(), mask);
+    probe.phase(StatsData::PERF_FILL);
+    return true;
+}
+
+/*! \brief rewrite a part of the memory area with random data
+ *
+ * @param data pointer to memory area
+ * @param window partial update
+ * @param mask bitmask that is applied to the generated random values
+ * @param filler (multi threaded) random data generator
+ * @param sync synchronization with the readers of the shared memory (nullptr: no synchronization)
+ * @param stats runtime statistics (nullptr: no statistics)
+ * @return false if the frame was skipped (see FrameSync::begin)
+ */
+inline bool partial_random_data(void           *data,
+                                UpdateWindow   &window,
+                                const LaneMask &mask,
+                                ParallelFill   &filler,
+                                FrameSync      *sync,
+                                StatsExport    *stats) {
+    FillProbe probe(stats);
+    if (sync && !sync->begin()) return false;
+    probe.synced();
+
+    window.update(data, mask, filler);
+
+    if (sync) sync->end();
+    probe.finish(StatsData::PERF_FILL, window.get_update_size());
+    return true;
+}
+
+/*! \brief write the next chunk of the memory area with the target rate
+ *
+ * @param data pointer to memory area
+ * @param pacer rate pacer
+ * @param mask bitmask that is applied to the generated random values
+ * @param filler (multi threaded) random data generator
+ * @param sync synchronization with the readers of the shared memory (nullptr: no synchronization)
+ * @param stats runtime statistics (nullptr: no statistics)
+ * @return false if nothing was due or the frame was skipped (see FrameSync::begin)
+ */
+inline bool paced_random_data(void           *data,
+                              RatePacer      &pacer,
+                              const LaneMask &mask,
+                              ParallelFill   &filler,
+                              FrameSync      *sync,
+                              StatsExport    *stats) {
+    if (!pacer.refill()) return false;
+
+    // the tokens and the chunk are kept for the next tick if the frame is skipped
+    FillProbe probe(stats);
+    if (sync && !sync->begin()) return false;
+    probe.synced();
+
+    pacer.next();
+    pacer.write(data, mask, filler);
+
+    if (sync) sync->end();
+    probe.finish(StatsData::PERF_FILL, pacer.get_update_size());
+    return true;
+}
+
+/*! \brief fill all regions that are due with random data
+ *
+ * @details All due regions are written within one synchronization.
+ *
+ * @param data pointer to the shared memory
+ * @param regions memory regions
+ * @param filler (multi threaded) random data generator
+ * @param sync synchronization with the readers of the shared memory (nullptr: no synchronization)
+ * @param stats runtime statistics (nullptr: no statistics)
+ * @return false if no region was due or the frame was skipped (see FrameSync::begin)
+ */
+inline bool
+        region_random_data(void *data, RegionSet &regions, ParallelFill &filler, FrameSync *sync, StatsExport *stats) {
+    if (!regions.advance()) return false;
+
+    FillProbe probe(stats);
+    if (sync && !sync->begin()) return false;
+    probe.synced();
+
+    const auto written = regions.fill(data, filler);
+
+    if (sync) sync->end();
+    probe.finish(StatsData::PERF_FILL, written);
+    return true;
+}
+
+/*! \brief copy the next recorded frame to the memory area
+ *
+ * @param data pointer to memory area
+ * @param source replay source (frame size: size of the memory area)
+ * @param filler (multi threaded) copy
+ * @param sync synchronization with the readers of the shared memory (nullptr: no synchronization)
+ * @param stats runtime statistics (nullptr: no statistics)
+ * @return false if no frame was available or the frame was skipped (see FrameSync::begin)
+ */
+inline bool replay_data(void *data, ReplaySource &source, ParallelFill &filler, FrameSync *sync, StatsExport *stats) {
+    const void *frame = source.acquire();
+    if (!frame) return false;
+
+    FillProbe probe(stats);
+    if (sync && !sync->begin()) return false;
+    probe.synced();
+
+    filler.copy(data, frame, source.get_frame_size());
+
+    if (sync) sync->end();
+    source.release();
+    probe.finish(StatsData::PERF_COPY, source.get_frame_size());
+    return true;
+}
+
+/*! \brief apply --hugepages and --prefault to a memory area
+ *
+ * @details Failures are reported as warnings.
+ *
+ * @param addr page aligned address of the memory area
+ * @param size size of the memory area in bytes
+ * @param name name of the memory area (for warnings)
+ * @param hugepages request transparent huge pages
+ * @param prefault fault in and lock all pages
+ */
+static void prepare_memory(void *addr, std::size_t size, const std::string &name, bool hugepages, bool prefault) {
+    if (hugepages) {
+        try {
+            advise_hugepages(addr, size);
+        } catch (const std::system_error &e) {
+            std::cerr << "WARNING: Failed to enable huge pages for '" << name << "': " << e.what() << '\n';
         }
     }
 
-    for (std::size_t i = 0; i < elements; ++i) {
-        reinterpret_cast<T *>(data)[i] = dist(re) & static_cast<T>(bitmask);  // NOLINT
+    if (prefault) {
+        prefault_memory(addr, size);
+        try {
+            lock_memory(addr, size);
+        } catch (const std::system_error &e) {
+            std::cerr << "WARNING: Failed to lock '" << name << "' in memory: " << e.what() << '\n';
+        }
     }
-
-    if (semaphore && semaphore->is_acquired()) semaphore->post();
 }
 
 int main(int argc, char **argv) {  // NOLINT
@@ -85,11 +285,144 @@ int main(int argc, char **argv) {  // NOLINT
     options.add_options("settings")("m,mask",
                                     "optional bitmask (as hex value) that is applied to the generated random values",
                                     cxxopts::value<std::string>());
+    options.add_options("settings")("distribution",
+                                    "value distribution of the generated elements: "
+                                    "uniform:MIN,MAX, normal:MEAN,STDDEV, exponential:LAMBDA or "
+                                    "discrete:VALUE=WEIGHT,VALUE=WEIGHT,... (see --type). "
+                                    "Can not be combined with --mask.",
+                                    cxxopts::value<std::string>());
+    options.add_options("settings")("type",
+                                    "element type for --distribution: "
+                                    "u8, i8, u16, i16, u32, i32, u64, i64, f32 or f64. "
+                                    "Implies the alignment. Default: unsigned integer of the size of --alignment",
+                                    cxxopts::value<std::string>());
+    options.add_options("settings")("engine",
+                                    "random engine that is used to generate the random values. "
+                                    "(xoshiro256x8, xoshiro256ss, wyrand, splitmix64, pcg64, mt19937_64, minstd)",
+                                    cxxopts::value<std::string>()->default_value("xoshiro256x8"));
+    options.add_options("settings")("seed",
+                                    "seed of the random engines. "
+                                    "Enables the reproducible mode: the generated data depends only on the seed, "
+                                    "the generation (number of the fill, see --generation) and the settings that "
+                                    "define the memory layout, but not on the number of threads.",
+                                    cxxopts::value<std::uint64_t>());
+    options.add_options("settings")("generation",
+                                    "generation of the first fill (requires --seed). "
+                                    "Use with '-l 1' to regenerate the data of a previous fill.",
+                                    cxxopts::value<std::uint64_t>()->default_value("0"));
+    options.add_options("settings")("threads",
+                                    "number of threads that are used to generate the random values. "
+                                    "The semaphore (if used) is acquired once for all threads.",
+                                    cxxopts::value<std::size_t>()->default_value("1"));
+    options.add_options("settings")("cpu-list",
+                                    "pin the threads to the given cpus (e.g. 0-3,8). "
+                                    "Thread i is pinned to the i-th cpu of the list.",
+                                    cxxopts::value<std::string>());
+    options.add_options("settings")("numa",
+                                    "move the memory area of every thread to the NUMA node of the thread. "
+                                    "Should be combined with --cpu-list.");
+    options.add_options("settings")("prebuffer",
+                                    "generate the next random values in a private buffer between two intervals. "
+                                    "While the semaphore is held, the buffer is only copied to the shared memory.");
+    options.add_options("settings")("update-fraction",
+                                    "rewrite only the given fraction (0 < arg <= 1) of the memory area per interval. "
+                                    "The memory area is split into 64 byte blocks, see --window. "
+                                    "The entire memory area is written in the first interval.",
+                                    cxxopts::value<double>());
+    options.add_options("settings")("rate",
+                                    "write the memory area in chunks with the given rate instead of completely "
+                                    "every interval, e.g. 2GiB/s (units: B, kB, MB, GB, TB, KiB, MiB, GiB, TiB). "
+                                    "The chunks are paced with a token bucket every interval (default: 1ms).",
+                                    cxxopts::value<std::string>());
+    options.add_options("settings")("updates-per-sec",
+                                    "like --rate, but the rate is given in elements per second (e.g. 1e8)",
+                                    cxxopts::value<double>());
+    options.add_options("settings")("window",
+                                    "block selection for --update-fraction: "
+                                    "sliding (contiguous window that moves forward every interval) or "
+                                    "random (randomly selected blocks)",
+                                    cxxopts::value<std::string>()->default_value("sliding"));
+    options.add_options("settings")("store",
+                                    "store type used to write the shared memory: "
+                                    "cached (normal stores), "
+                                    "stream (non-temporal stores that bypass the cache) or "
+                                    "auto (stream if the written memory area is at least --stream-threshold bytes)",
+                                    cxxopts::value<std::string>()->default_value("auto"));
+    options.add_options("settings")("stream-threshold",
+                                    "minimum size in bytes for non-temporal stores with --store auto. "
+                                    "Default: size of the last level cache",
+                                    cxxopts::value<std::size_t>());
+    options.add_options("replay")("replay",
+                                  "write recorded frames of the given file instead of random values. "
+                                  "One frame (the written memory area, see --offset and --elements) per interval. "
+                                  "Regular files are mapped and replayed in a loop (see --replay-once). "
+                                  "Pipes, FIFOs and stdin (-) are read ahead into a ring buffer (see --replay-buffer), "
+                                  "the application terminates at the end of the input.",
+                                  cxxopts::value<std::string>());
+    options.add_options("replay")("replay-buffer",
+                                  "number of frames in the read ahead ring buffer (pipes, FIFOs and stdin)",
+                                  cxxopts::value<std::size_t>()->default_value("16"));
+    options.add_options("replay")("replay-once", "terminate after the last frame of a regular file");
+    options.add_options("record")("record",
+                                  "record every frame that is written to the shared memory to the given file. "
+                                  "The file is written by a separate thread (O_DIRECT if supported), "
+                                  "see --record-format.",
+                                  cxxopts::value<std::string>());
+    options.add_options("record")("record-format",
+                                  "raw (all frames, back to back, can be replayed with --replay) or "
+                                  "generation (only the generation of every frame, requires --seed "
+                                  "and can not be combined with --sync stripes; "
+                                  "a frame is regenerated with --seed, --generation and '-l 1')",
+                                  cxxopts::value<std::string>()->default_value("raw"));
+    options.add_options("record")("record-buffer",
+                                  "size of the record buffer in bytes. "
+                                  "Frames are dropped if the buffer is full. "
+                                  "At most half of the physical memory. "
+                                  "Default: 8 frames, at least 64 MiB and at most 1 GiB (but at least one frame)",
+                                  cxxopts::value<std::size_t>());
+    options.add_options("regions")(
+            "region",
+            "write random values to the given region of the shared memory. Can be used multiple times. "
+            "Format: comma separated key=value pairs, e.g. offset=64,elements=16,alignment=4,mask=ff,interval=10ms. "
+            "All keys are optional. Can not be combined with --offset, --elements, --alignment and --mask.",
+            cxxopts::value<std::vector<std::string>>());
+    options.add_options("regions")("region-file",
+                                   "read regions from the given file (one region per line, see --region). "
+                                   "Empty lines and lines starting with # are ignored.",
+                                   cxxopts::value<std::string>());
+    options.add_options("shared memory")(
+            "n,name",
+            "mandatory name of the shared memory object. "
+            "Can be used multiple times to fill multiple shared memories with the same settings.",
+            cxxopts::value<std::vector<std::string>>());
     options.add_options("shared memory")(
-            "n,name", "mandatory name of the shared memory object", cxxopts::value<std::string>());
+            "manifest",
+            "fill all shared memories that are listed in the given file. One shared memory per line: "
+            "name=mem,semaphore=sem,offset=64,elements=16,alignment=4,mask=ff,interval=10ms. "
+            "All keys except name are optional. Empty lines and lines starting with # are ignored. "
+            "Can not be combined with --name.",
+            cxxopts::value<std::string>());
+    options.add_options("shared memory")(
+            "batch",
+            "read jobs from stdin (one per line, format of --manifest) and write every job once as it is read. "
+            "The interval of a job is ignored. Terminates at the end of the input.");
     options.add_options("settings")("i,interval",
                                     "random value generation interval in milliseconds",
                                     cxxopts::value<std::size_t>()->default_value("1000"));
+    options.add_options("settings")("period",
+                                    "random value generation interval with unit (ns, us, ms or s, e.g. 250us). "
+                                    "Overrides --interval.",
+                                    cxxopts::value<std::string>());
+    options.add_options("settings")("overrun",
+                                    "behavior if the generation takes longer than one interval: "
+                                    "skip (skip the missed intervals), "
+                                    "catch-up (generate the missed intervals immediately) or "
+                                    "drift (start the next interval when the generation is finished)",
+                                    cxxopts::value<std::string>()->default_value("skip"));
+    options.add_options("settings")("realtime",
+                                    "run all threads with the real time scheduling policy SCHED_FIFO "
+                                    "and the given priority (1-99)",
+                                    cxxopts::value<int>());
     options.add_options("settings")("l,limit",
                                     "random interval limit. Use 0 for no limit (--> run until SIGINT / SIGTERM).",
                                     cxxopts::value<std::size_t>()->default_value("0"));
@@ -112,6 +445,74 @@ int main(int argc, char **argv) {  // NOLINT
             "protect the shared memory with a named semaphore against simultaneous access. "
             "If -c is used, the semaphore is created, otherwise an existing semaphore is required.",
             cxxopts::value<std::string>());
+    options.add_options("shared memory")(
+            "sync",
+            "synchronization with the readers of the shared memory: "
+            "semaphore (default if --semaphore is used) or "
+            "seqlock (lock free, sequence counter in a header of the shared memory, see --sync-offset) or "
+            "stripes (one lock per --stripe-size bytes in a lock table at --sync-offset)",
+            cxxopts::value<std::string>());
+    options.add_options("shared memory")("notify",
+                                         "increment a 32 bit generation word at this offset (in bytes) of the shared "
+                                         "memory after every frame and wake the readers that wait on it (futex). "
+                                         "The word must not overlap with the random data.",
+                                         cxxopts::value<std::size_t>());
+    options.add_options("shared memory")("stripe-size",
+                                         "size of the stripes of --sync stripes in bytes (multiple of 64)",
+                                         cxxopts::value<std::size_t>()->default_value("65536"));
+    options.add_options("shared memory")("stripe-timeout",
+                                         "maximum time to wait for the stripe locks of one frame with unit "
+                                         "(see --period). A stripe that is not locked in time is skipped. "
+                                         "0: wait forever. Default: half of the interval (tick period with --region)",
+                                         cxxopts::value<std::string>());
+    options.add_options("shared memory")("sync-offset",
+                                         "offset of the synchronization header (in bytes) in the shared memory. "
+                                         "The header must not overlap with the random data (see --offset).",
+                                         cxxopts::value<std::size_t>()->default_value("0"));
+    options.add_options("shared memory")(
+            "frames",
+            "use a shared memory layout with arg frames and a header that contains the index of the current frame. "
+            "The frames are written alternately, without locking. "
+            "If -c is used, the given size is the size of one frame. "
+            "Offset and elements refer to a single frame.",
+            cxxopts::value<std::uint32_t>());
+    options.add_options("shared memory")("hugepages",
+                                         "use transparent huge pages for the shared memory (madvise). "
+                                         "Requires huge pages for shmem to be enabled "
+                                         "(/sys/kernel/mm/transparent_hugepage/shmem_enabled).");
+    options.add_options("shared memory")("prefault",
+                                         "fault in and lock (mlock) all pages of the shared memory at startup");
+    options.add_options("shared memory")("reattach",
+                                         "watch /dev/shm (inotify) and reattach to the shared memory and the semaphore "
+                                         "if they are recreated by their owner. "
+                                         "Can not be combined with --create and --pid.");
+    options.add_options("shared memory")(
+            "semaphore-strategy",
+            "acquisition of the semaphore: "
+            "timeout (wait up to --semaphore-timeout, write the frame anyway after a timeout), "
+            "spin (try for --semaphore-spin, then wait up to --semaphore-timeout), "
+            "deadline (wait until the next interval minus the duration of the last write), "
+            "skip (skip the frame if the semaphore is held) or "
+            "adaptive (timeout derived from the observed waits, at most --semaphore-timeout). "
+            "Except for timeout, a frame is skipped if the semaphore is not acquired.",
+            cxxopts::value<std::string>()->default_value("timeout"));
+    options.add_options("shared memory")("semaphore-timeout",
+                                         "maximum time to wait for the semaphore with unit (see --period). "
+                                         "0: wait forever. Default: half of the interval (tick period with --region)",
+                                         cxxopts::value<std::string>());
+    options.add_options("shared memory")("semaphore-spin",
+                                         "busy wait of --semaphore-strategy spin with unit (see --period)",
+                                         cxxopts::value<std::string>()->default_value("50us"));
+    options.add_options("shared memory")("semaphore-error-limit",
+                                         "terminate if the semaphore error counter reaches this value (0: never). "
+                                         "Every failed acquisition increases the counter by --semaphore-error-cost, "
+                                         "every successful acquisition decreases it by one.",
+                                         cxxopts::value<std::size_t>()->default_value("1000"));
+    options.add_options("shared memory")("semaphore-error-cost",
+                                         "increment of the semaphore error counter per failed acquisition. "
+                                         "Default: 100 for --semaphore-strategy timeout, "
+                                         "0 for the strategies that skip frames",
+                                         cxxopts::value<std::size_t>());
     options.add_options("shared memory")(
             "semaphore-force",
             "Force the use of the semaphore even if it already exists. "
@@ -119,6 +520,34 @@ int main(int argc, char **argv) {  // NOLINT
             "It should only be used if the semaphore of an improperly terminated instance continues "
             "to exist as an orphan and is no longer used. "
             "(Only relevant if -c is used.)");
+    options.add_options("benchmark")(
+            "benchmark",
+            "measure the fill throughput and latency and print the results. "
+            "Every combination of engine, alignment, thread count and sync is measured. "
+            "If one of '--engine', '--alignment', '--threads' or '--sync' is given, only this value is used. "
+            "The random values are written to an anonymous memory area, "
+            "or to the shared memory if '--name' is given. "
+            "'--offset' and '--elements' select the written part of the memory area.");
+    options.add_options("benchmark")("benchmark-size",
+                                     "size of the anonymous memory area in bytes",
+                                     cxxopts::value<std::size_t>()->default_value("67108864"));
+    options.add_options("benchmark")("benchmark-iterations",
+                                     "number of measured fills per combination",
+                                     cxxopts::value<std::size_t>()->default_value("100"));
+    options.add_options("benchmark")("benchmark-format",
+                                     "output format: csv or json",
+                                     cxxopts::value<std::string>()->default_value("csv"));
+    options.add_options("statistics")("export-stats",
+                                      "export runtime statistics (fills, fill duration, sync wait histogram, ...) "
+                                      "via the shared memory <name>.stats");
+    options.add_options("statistics")(
+            "perf-counters",
+            "measure cycles, instructions, LLC misses, dTLB misses and page faults (perf_event_open) of the sync wait, "
+            "the fill and the copy of every tick. "
+            "The results are part of the exported statistics (requires '--export-stats') or of the benchmark results. "
+            "Adds a few system calls per tick.");
+    options.add_options("statistics")(
+            "stats", "print the statistics of the instance that writes to the shared memory --name and exit");
     options.add_options("other")("h,help", "print usage");
     options.add_options("version information")("version", "print version and exit");
     options.add_options("version information")("longversion",
@@ -156,7 +585,6 @@ int main(int argc, char **argv) {  // NOLINT
         std::cout << "  - cxxopts by jarro2783 (https://github.com/jarro2783/cxxopts)" << '\n';
         std::cout << "  - cxxshm (https://github.com/NikolasK-source/cxxshm)" << '\n';
         std::cout << "  - cxxsemaphore (https://github.com/NikolasK-source/cxxsemaphore)" << '\n';
-        std::cout << "  - cxxitimer (https://github.com/NikolasK-source/cxxitimer)" << '\n';
         return EX_OK;
     }
 
@@ -194,18 +622,72 @@ int main(int argc, char **argv) {  // NOLINT
         return EX_OK;
     }
 
-    const auto name_count = args.count("name");
-    if (name_count != 1) {
-        if (!name_count) {
-            std::cerr << "no shared memory specified." << '\n';
-            std::cerr << "argument '--name' is mandatory." << '\n';
-        } else {
-            std::cerr << "multiple definitions of '--name' are not allowed." << '\n';
-        }
+    const bool ARG_BENCHMARK = args.count("benchmark");
+
+    const bool ARG_MANIFEST = args.count("manifest");
+    const bool ARG_BATCH    = args.count("batch");
+
+    std::vector<std::string> shm_names;
+    if (args.count("name")) shm_names = args["name"].as<std::vector<std::string>>();
+    if (shm_names.empty() && !ARG_BENCHMARK && !ARG_MANIFEST && !ARG_BATCH) {
+        std::cerr << "no shared memory specified." << '\n';
+        std::cerr << "argument '--name' is mandatory." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    if (ARG_MANIFEST && !shm_names.empty()) {
+        std::cerr << "'--manifest' can not be combined with '--name'." << '\n';
         std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
         return EX_USAGE;
     }
-    const std::string shm_name = args["name"].as<std::string>();
+
+    // multiple shared memories (see SegmentDriver)
+    const bool ARG_MULTI_SEGMENT = shm_names.size() > 1 || ARG_MANIFEST;
+    if (ARG_MULTI_SEGMENT && (ARG_BENCHMARK || args.count("stats"))) {
+        if (ARG_MANIFEST) std::cerr << "'--manifest' can not be combined with '--benchmark' or '--stats'." << '\n';
+        else std::cerr << "multiple definitions of '--name' are not allowed." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    if (ARG_BATCH && (ARG_BENCHMARK || args.count("stats") || !shm_names.empty() || ARG_MANIFEST)) {
+        std::cerr << "'--batch' can not be combined with '--name', '--manifest', '--benchmark' or '--stats'." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    const bool ARG_PERF = args.count("perf-counters");
+    if (ARG_PERF && !ARG_BENCHMARK && !args.count("export-stats")) {
+        std::cerr << "'--perf-counters' requires '--export-stats' or '--benchmark'." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    const auto        name_count = shm_names.size();
+    const std::string shm_name   = shm_names.empty() ? std::string() : shm_names.front();
+
+    if (args.count("stats")) {
+        if (!name_count) {
+            std::cerr << "argument '--name' is required for '--stats'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        try {
+            StatsExport::print(shm_name, std::cout);
+        } catch (const std::system_error &e) {
+            std::cerr << e.what() << '\n';
+            return EX_OSERR;
+        } catch (const std::runtime_error &e) {
+            std::cerr << e.what() << '\n';
+            return EX_DATAERR;
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << '\n';
+            return EX_OSERR;
+        }
+        return EX_OK;
+    }
 
 
     enum alignment_t { BYTE = 1, WORD = 2, DWORD = 4, QWORD = 8 } alignment = BYTE;
@@ -228,9 +710,94 @@ int main(int argc, char **argv) {  // NOLINT
         }
     }
 
-    const auto  interval_counter   = args["limit"].as<std::size_t>();
-    const auto  random_interval_ms = interval_counter != 1 ? args["interval"].as<std::size_t>() : 0;
-    std::size_t bitmask            = ~static_cast<std::size_t>(0);  // no mask
+    std::shared_ptr<const Distribution> distribution;
+    if (args.count("distribution")) {
+        if (args.count("mask")) {
+            std::cerr << "'--distribution' can not be combined with '--mask'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        const auto type = args.count("type") ? args["type"].as<std::string>()
+                                             : 'u' + std::to_string(static_cast<std::size_t>(alignment) * 8);  // NOLINT
+        try {
+            distribution = make_distribution(args["distribution"].as<std::string>(), type);
+        } catch (const std::invalid_argument &e) {
+            std::cerr << e.what() << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        if (alignment_count && distribution->element_size() != static_cast<std::size_t>(alignment)) {
+            std::cerr << "'--alignment' does not match the size of element type '" << type << "'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        alignment = static_cast<alignment_t>(distribution->element_size());
+    } else if (args.count("type")) {
+        std::cerr << "'--type' requires '--distribution'." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    const auto interval_counter = args["limit"].as<std::size_t>();
+
+    if (args.count("period") > 1) {
+        std::cerr << "multiple definitions of '--period' are not allowed." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    std::chrono::nanoseconds period = std::chrono::milliseconds(args["interval"].as<std::size_t>());
+    if (args.count("period")) {
+        try {
+            period = parse_duration(args["period"].as<std::string>());
+        } catch (const std::invalid_argument &) {
+            std::cerr << '\'' << args["period"].as<std::string>() << "' is not a valid value for '--period'" << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+    }
+    // --rate: fine grained pacing, unless the interval is given explicitly
+    static constexpr std::chrono::nanoseconds DEFAULT_RATE_TICK = std::chrono::milliseconds(1);
+    const bool ARG_RATE = args.count("rate") || args.count("updates-per-sec");
+    if (ARG_RATE && !args.count("interval") && !args.count("period")) period = DEFAULT_RATE_TICK;
+    if (interval_counter == 1) period = std::chrono::nanoseconds::zero();
+
+    if (args.count("overrun") > 1) {
+        std::cerr << "multiple definitions of '--overrun' are not allowed." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    Scheduler::overrun_t overrun;
+    try {
+        overrun = parse_overrun(args["overrun"].as<std::string>());
+    } catch (const std::invalid_argument &) {
+        std::cerr << '\'' << args["overrun"].as<std::string>() << "' is not a valid value for '--overrun'" << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    if (args.count("realtime") > 1) {
+        std::cerr << "multiple definitions of '--realtime' are not allowed." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    // SIGINT and SIGTERM are handled by the scheduler and have to be blocked before any thread is created.
+    // The benchmark and batch runs check for pending signals between their measurements and jobs.
+    // One shot runs finish their fill (and release the semaphore) before the pending signal terminates them.
+    // The real time scheduling policy is inherited by the threads as well.
+    try {
+        Scheduler::block_signals();
+        if (args.count("realtime")) Scheduler::set_realtime(args["realtime"].as<int>());
+    } catch (const std::system_error &e) {
+        std::cerr << e.what() << '\n';
+        return EX_OSERR;
+    }
+
+    std::size_t bitmask = ~static_cast<std::size_t>(0);  // no mask
 
     const auto mask_count = args.count("mask");
     if (mask_count > 1) {
@@ -249,135 +816,979 @@ int main(int argc, char **argv) {  // NOLINT
         }
     }
 
-    if (signal(SIGINT, sig_term_handler) == SIG_ERR || signal(SIGTERM, sig_term_handler) == SIG_ERR) {
-        perror("signal");
-        return EX_OSERR;
+    const auto engine_count = args.count("engine");
+    if (engine_count > 1) {
+        std::cerr << "multiple definitions of '--engine' are not allowed." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
     }
 
-    std::unique_ptr<cxxshm::SharedMemory> shm;
-    const bool                            ARG_CREATE        = args.count("create");
-    pid_t                                 shm_owner_pid     = 0;
-    bool                                  use_shm_owner_pid = false;
-
-    if (ARG_CREATE) {
-        const auto shm_size      = args["create"].as<std::size_t>();
-        const auto shm_exclusive = !args.count("force");
-        const auto shm_mode_str  = args["permissions"].as<std::string>();
-
-        mode_t      mode = 0;
-        bool        fail = false;
-        std::size_t idx  = 0;
-        try {
-            mode = static_cast<decltype(mode)>(std::stoul(shm_mode_str, &idx, 0));
-        } catch (const std::exception &) { fail = true; }
-        fail = fail || idx != shm_mode_str.size();
+    const auto threads_count = args.count("threads");
+    if (threads_count > 1) {
+        std::cerr << "multiple definitions of '--threads' are not allowed." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
 
-        if (fail) throw std::invalid_argument("Failed to parse permissions '" + shm_mode_str + '\'');
+    const auto threads = args["threads"].as<std::size_t>();
+    if (threads == 0) {
+        std::cerr << "0 is not a valid value for '--threads'" << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
 
+    std::vector<int> cpus;
+    if (args.count("cpu-list")) {
         try {
-            shm = std::make_unique<cxxshm::SharedMemory>(shm_name, shm_size, false, shm_exclusive, mode);
-        } catch (std::exception &e) {
-            std::cerr << e.what() << '\n';
-            return EX_OSERR;
-        }
-    } else {
-        try {
-            shm = std::make_unique<cxxshm::SharedMemory>(shm_name);
-        } catch (std::exception &e) {
-            std::cerr << e.what() << '\n';
-            return EX_OSERR;
-        }
-
-        if (args.count("pid") == 0) {
-            if (interval_counter != 1) {
-                std::cerr << "Warning: No SHM owner PID provided.\n"
-                             "         This application is NOT terminated if the owner of the shared memory closes the "
-                             "shared memory.\n"
-                             "         This application WILL NOT reconnect to the shared memory if it is recreated.\n"
-                             "         Use --pid to specify the PID of the SHM owner.\n";
-                std::cerr << std::flush;
-            }
-        } else {
-            if (interval_counter != 1) {
-                shm_owner_pid     = args["pid"].as<pid_t>();
-                use_shm_owner_pid = true;
-            }
+            cpus = parse_cpu_list(args["cpu-list"].as<std::string>());
+        } catch (const std::invalid_argument &) {
+            std::cerr << '\'' << args["cpu-list"].as<std::string>() << "' is not a valid value for '--cpu-list'"
+                      << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
         }
     }
 
-    const auto OFFSET = args["offset"].as<std::size_t>();
-    const auto SIZE   = OFFSET > shm->get_size() ? 0 : (shm->get_size() - OFFSET);
+    const bool ARG_NUMA = args.count("numa");
+    if (ARG_NUMA && cpus.empty())
+        std::cerr << "WARNING: '--numa' is used without '--cpu-list'. Threads may migrate to other NUMA nodes." << '\n';
 
-    std::cerr << "INFO: Opened shared memory '" << shm_name << "'. Size: " << shm->get_size()
-              << (shm->get_size() != 1 ? " bytes" : " byte") << '.';
-    if (OFFSET) std::cerr << " (Effective size: " << SIZE << (SIZE != 1 ? " bytes" : " byte") << ")";
-    std::cerr << '\n';
+    if (ARG_BENCHMARK) {
+        BenchmarkConfig config;
+        config.iterations   = args["benchmark-iterations"].as<std::size_t>();
+        config.cpus         = cpus;
+        config.numa         = ARG_NUMA;
+        config.distribution = distribution;
+        config.perf         = ARG_PERF;
 
-    if (OFFSET % args["alignment"].as<unsigned>() != 0)
-        std::cerr << "WARNING: Invalid alignment detected. Performance issues possible." << '\n';
+        if (args.count("engine")) config.engines.push_back(args["engine"].as<std::string>());
+        else config.engines = engine_names();
 
-    std::size_t shm_elements = SIZE / static_cast<std::size_t>(alignment);
-    if (args.count("elements")) { shm_elements = std::min(shm_elements, args["elements"].as<std::size_t>()); }
+        if (alignment_count || distribution) config.alignments.push_back(alignment);
+        else config.alignments = {BYTE, WORD, DWORD, QWORD};
 
-    if (shm_elements == 0) {
-        std::cerr << "no elements to work on. (Either is the shared memory to small to create at least one element ";
-        std::cerr << "with the specified allignment or the parameter elements is 0.)" << '\n';
-        return EX_DATAERR;
-    }
+        if (threads_count) {
+            config.threads.push_back(threads);
+        } else {
+            const std::size_t max_threads = std::max(1U, std::thread::hardware_concurrency());
+            for (std::size_t i = 1; i < max_threads; i *= 2)
+                config.threads.push_back(i);
+            config.threads.push_back(max_threads);
+        }
 
-    std::unique_ptr<cxxsemaphore::Semaphore> semaphore;
-    timespec                                 semaphore_max_time {0, 0};
+        if (args.count("sync")) {
+            const auto tmp = args["sync"].as<std::string>();
+            if (tmp != "none" && tmp != "semaphore" && tmp != "seqlock") {
+                std::cerr << '\'' << tmp << "' is not a valid value for '--sync'" << '\n';
+                std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+                return EX_USAGE;
+            }
+            config.syncs.push_back(tmp);
+        } else {
+            config.syncs = {"none", "semaphore", "seqlock"};
+        }
 
-    if (args.count("semaphore")) {
-        const auto semaphore_name = args["semaphore"].as<std::string>();
+        const auto format = args["benchmark-format"].as<std::string>();
+        if (format != "csv" && format != "json") {
+            std::cerr << '\'' << format << "' is not a valid value for '--benchmark-format'" << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
 
+        std::unique_ptr<cxxshm::SharedMemory> shm;
+        std::unique_ptr<PrivateBuffer>        buffer;
+        void                                 *data;
+        std::size_t                           size;
         try {
-            if (ARG_CREATE) {
-                const bool force = args.count("semaphore-force");
-                semaphore        = std::make_unique<cxxsemaphore::Semaphore>(semaphore_name, 1, force);
+            if (name_count) {
+                shm  = std::make_unique<cxxshm::SharedMemory>(shm_name);
+                data = shm->get_addr<void *>();
+                size = shm->get_size();
             } else {
-                semaphore = std::make_unique<cxxsemaphore::Semaphore>(semaphore_name);
+                buffer = std::make_unique<PrivateBuffer>(args["benchmark-size"].as<std::size_t>());
+                data   = buffer->get_addr();
+                size   = buffer->get_size();
             }
         } catch (const std::exception &e) {
             std::cerr << e.what() << '\n';
-            return EX_SOFTWARE;
+            return EX_OSERR;
         }
 
-        semaphore_max_time = {static_cast<__time_t>((random_interval_ms / 2) / 1000),                        // NOLINT
-                              static_cast<__syscall_slong_t>(((random_interval_ms / 2) % 1000) * 1000000)};  // NOLINT
-    } else {
-        std::cerr << "WARNING: No semaphore specified.\n"
-                     "         Concurrent access to the shared memory is possible.\n"
-                     "         This can result in CORRUPTED DATA.\n"
-                     "         Use --semaphore to specify a semaphore.\n";
-        std::cerr << std::flush;
-    }
-
-    // interval timer
-    const struct timeval interval_time {
-        static_cast<__time_t>(random_interval_ms / 1000),                           // NOLINT
-                static_cast<__syscall_slong_t>((random_interval_ms % 1000) * 1000)  // NOLINT
-    };
-    cxxitimer::ITimer_Real interval_timer(interval_time);
-    if (random_interval_ms) interval_timer.start();
-
-    sigset_t sleep_sigset;
-    sigemptyset(&sleep_sigset);
-    sigaddset(&sleep_sigset, SIGALRM);
-    sigprocmask(SIG_BLOCK, &sleep_sigset, nullptr);
-    sigaddset(&sleep_sigset, SIGINT);
-    sigaddset(&sleep_sigset, SIGTERM);
-
-    // MAIN loop
-    std::size_t counter = 0;
+        // --offset and --elements select the measured part of the memory area
+        const auto offset = args["offset"].as<std::size_t>();
+        if (offset >= size) {
+            std::cerr << "'--offset' is outside of the benchmark memory area (" << size << " bytes)." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        data = static_cast<std::uint8_t *>(data) + offset;
+        size -= offset;
+        if (args.count("elements")) config.elements = args["elements"].as<std::size_t>();
 
-    auto handle_counter = [&]() {
-        if (interval_counter) {
+        std::vector<BenchmarkResult> results;
+        try {
+            results = run_benchmark(config, data, size);
+        } catch (const std::invalid_argument &e) {
+            std::cerr << e.what() << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << '\n';
+            return EX_OSERR;
+        }
+
+        if (Scheduler::termination_pending()) std::cerr << "Terminating..." << '\n';
+
+        if (format == "json") print_benchmark_json(std::cout, results);
+        else print_benchmark_csv(std::cout, results);
+        return EX_OK;
+    }
+
+    const bool ARG_SEED = args.count("seed");
+    if (args.count("generation") && !ARG_SEED) {
+        std::cerr << "'--generation' requires '--seed'." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+    std::uint64_t generation = args["generation"].as<std::uint64_t>();
+
+    // opened before the worker threads are created: the counters are inherited by all threads
+    std::unique_ptr<PerfCounters> perf;
+    if (ARG_PERF) {
+        try {
+            perf = std::make_unique<PerfCounters>();
+        } catch (const std::system_error &e) {
+            std::cerr << e.what() << '\n';
+            return EX_OSERR;
+        }
+        const auto available = perf->get_available();
+        if (available != (std::uint64_t {1} << PerfCounters::EVENTS) - 1) {
+            std::cerr << "WARNING: Not all perf counters are available:";
+            for (std::size_t i = 0; i < PerfCounters::EVENTS; ++i)
+                if (!(available & (std::uint64_t {1} << i))) std::cerr << ' ' << PerfCounters::event_name(i);
+            std::cerr << '\n';
+        }
+    }
+
+    std::unique_ptr<ParallelFill> filler;
+    std::uint64_t                 seed;
+    try {
+        if (ARG_SEED) {
+            seed = args["seed"].as<std::uint64_t>();
+        } else {
+            seed = entropy_seed();
+        }
+        filler = std::make_unique<ParallelFill>(args["engine"].as<std::string>(), threads, seed, cpus, ARG_NUMA);
+        if (ARG_SEED) filler->set_seed(seed);
+    } catch (const std::invalid_argument &) {
+        std::cerr << '\'' << args["engine"].as<std::string>() << "' is not a valid value for '--engine'" << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    } catch (const std::system_error &e) {
+        std::cerr << e.what() << '\n';
+        return EX_OSERR;
+    }
+
+    if (filler->get_engine().get_name() == "xoshiro256x8")
+        std::cerr << "INFO: Using " << Xoshiro256x8::kernel_name() << " kernel for random engine '"
+                  << filler->get_engine().get_name() << "'." << '\n';
+
+    if (ARG_SEED)
+        std::cerr << "INFO: Reproducible mode (seed " << seed << ", first generation " << generation << ")." << '\n';
+
+    if (distribution) {
+        filler->set_distribution(distribution);
+        std::cerr << "INFO: Using distribution " << distribution->describe() << '.' << '\n';
+    }
+
+    try {
+        const auto store     = parse_store(args["store"].as<std::string>());
+        const auto threshold = args.count("stream-threshold") ? args["stream-threshold"].as<std::size_t>() : 0;
+        if (args.count("stream-threshold") && threshold == 0) {
+            std::cerr << "'--stream-threshold' must not be 0" << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        filler->set_store(store, threshold);
+        if (store != ParallelFill::store_t::CACHED)
+            std::cerr << "INFO: Using " << stream_kernel_name() << " kernel for non-temporal stores"
+                      << (store == ParallelFill::store_t::AUTO
+                                  ? " (memory areas >= " + std::to_string(filler->get_stream_threshold()) + " bytes)"
+                                  : std::string())
+                      << '.' << '\n';
+    } catch (const std::invalid_argument &) {
+        std::cerr << '\'' << args["store"].as<std::string>() << "' is not a valid value for '--store'" << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    const bool ARG_HUGEPAGES = args.count("hugepages");
+    const bool ARG_PREFAULT  = args.count("prefault");
+
+    SemaphoreSync::Policy semaphore_policy;
+    try {
+        semaphore_policy.strategy = parse_semaphore_strategy(args["semaphore-strategy"].as<std::string>());
+        semaphore_policy.timeout  = args.count("semaphore-timeout")
+                                          ? parse_duration(args["semaphore-timeout"].as<std::string>())
+                                          : period / 2;
+        semaphore_policy.spin     = parse_duration(args["semaphore-spin"].as<std::string>());
+    } catch (const std::invalid_argument &e) {
+        std::cerr << e.what() << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+    semaphore_policy.error_limit = args["semaphore-error-limit"].as<std::size_t>();
+    // a skipped frame is the intended result of the skipping strategies, not an error
+    semaphore_policy.error_cost =
+            semaphore_policy.strategy == SemaphoreSync::strategy_t::TIMEOUT ? SemaphoreSync::SEM_ERROR_INC : 0;
+    if (args.count("semaphore-error-cost"))
+        semaphore_policy.error_cost = args["semaphore-error-cost"].as<std::size_t>();
+
+    const auto stripe_size = args["stripe-size"].as<std::size_t>();
+    if (stripe_size == 0 || stripe_size % StripeLocks::STRIPE_ALIGNMENT != 0) {
+        std::cerr << stripe_size << " is not a valid value for '--stripe-size'" << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    // default: half of the tick period (see below)
+    std::optional<std::chrono::nanoseconds> stripe_timeout;
+    try {
+        if (args.count("stripe-timeout")) stripe_timeout = parse_duration(args["stripe-timeout"].as<std::string>());
+    } catch (const std::invalid_argument &e) {
+        std::cerr << e.what() << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+    if (stripe_timeout && stripe_timeout->count() == 0) stripe_timeout.reset();
+
+    if (ARG_BATCH) {
+        for (const char *option : {"create",
+                                   "frames",
+                                   "semaphore",
+                                   "sync",
+                                   "prebuffer",
+                                   "update-fraction",
+                                   "region",
+                                   "region-file",
+                                   "export-stats",
+                                   "distribution",
+                                   "reattach",
+                                   "replay",
+                                   "record",
+                                   "notify",
+                                   "rate",
+                                   "updates-per-sec",
+                                   "pid"}) {
+            if (args.count(option)) {
+                std::cerr << "'--" << option << "' can not be combined with '--batch'." << '\n';
+                std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+                return EX_USAGE;
+            }
+        }
+
+        // the jobs have no schedule
+        if (semaphore_policy.strategy == SemaphoreSync::strategy_t::DEADLINE) {
+            std::cerr << "'--semaphore-strategy deadline' can not be combined with '--batch'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        std::size_t jobs        = 0;
+        std::size_t skipped     = 0;
+        std::size_t failed      = 0;
+        int         exit_code   = EX_OK;
+        std::size_t line_number = 0;
+        std::string line;
+
+        // the signals are only unblocked while waiting for the next job (no semaphore is held)
+        const auto read_job = [&line]() {
+            if (Scheduler::termination_pending()) return false;
+            Scheduler::unblock_signals();
+            const bool read = static_cast<bool>(std::getline(std::cin, line));
+            Scheduler::block_signals();
+            return read;
+        };
+
+        while (read_job()) {
+            ++line_number;
+            const auto first = line.find_first_not_of(" \t");
+            if (first == std::string::npos || line[first] == '#') continue;
+            const auto last = line.find_last_not_of(" \t\r");
+
+            try {
+                const auto spec = parse_segment(line.substr(first, last - first + 1));
+                filler->set_generation(generation);
+                if (!write_segment(spec, *filler, semaphore_policy, jobs)) ++skipped;
+            } catch (const std::invalid_argument &e) {
+                std::cerr << "line " << line_number << ": " << e.what() << '\n';
+                if (exit_code == EX_OK) exit_code = EX_DATAERR;
+                ++failed;
+            } catch (const std::exception &e) {
+                std::cerr << "line " << line_number << ": " << e.what() << '\n';
+                if (exit_code == EX_OK) exit_code = EX_OSERR;
+                ++failed;
+            }
+            ++jobs;
+        }
+
+        if (Scheduler::termination_pending()) std::cerr << "Terminating..." << '\n';
+
+        std::cerr << "INFO: Processed " << jobs << (jobs != 1 ? " jobs" : " job");
+        if (failed) std::cerr << ", " << failed << " failed";
+        if (skipped) std::cerr << ", " << skipped << " skipped because the semaphore was not available";
+        std::cerr << '.' << '\n';
+        return exit_code;
+    }
+
+    if (ARG_MULTI_SEGMENT) {
+        for (const char *option : {"create",
+                                   "frames",
+                                   "semaphore",
+                                   "sync",
+                                   "prebuffer",
+                                   "update-fraction",
+                                   "region",
+                                   "region-file",
+                                   "export-stats",
+                                   "distribution",
+                                   "reattach",
+                                   "replay",
+                                   "record",
+                                   "notify",
+                                   "rate",
+                                   "updates-per-sec",
+                                   "semaphore-timeout",
+                                   "pid"}) {
+            if (args.count(option)) {
+                std::cerr << "'--" << option << "' can not be used with multiple shared memories." << '\n';
+                std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+                return EX_USAGE;
+            }
+        }
+
+        std::vector<SegmentSpec> specs;
+        for (const auto &name : shm_names) {
+            SegmentSpec spec;
+            spec.name             = name;
+            spec.region.offset    = args["offset"].as<std::size_t>();
+            spec.region.alignment = alignment;
+            spec.region.mask      = bitmask;
+            if (args.count("elements")) spec.region.elements = args["elements"].as<std::size_t>();
+            specs.push_back(spec);
+        }
+
+        try {
+            if (ARG_MANIFEST) {
+                const auto manifest = read_segment_manifest(args["manifest"].as<std::string>());
+                specs.insert(specs.end(), manifest.begin(), manifest.end());
+            }
+        } catch (const std::invalid_argument &e) {
+            std::cerr << e.what() << '\n';
+            return EX_DATAERR;
+        } catch (const std::runtime_error &e) {
+            std::cerr << e.what() << '\n';
+            return EX_NOINPUT;
+        }
+
+        // one shot: write every shared memory once
+        if (interval_counter == 1) {
+            for (auto &spec : specs)
+                spec.region.interval.reset();
+        }
+
+        std::unique_ptr<SegmentDriver> driver;
+        std::unique_ptr<Scheduler>     scheduler;
+        try {
+            driver    = std::make_unique<SegmentDriver>(specs, period, semaphore_policy);
+            scheduler = std::make_unique<Scheduler>(driver->get_period(), overrun);
+        } catch (const std::invalid_argument &e) {
+            std::cerr << e.what() << '\n';
+            return EX_DATAERR;
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << '\n';
+            return EX_OSERR;
+        }
+
+        for (std::size_t i = 0; i < driver->size(); ++i) {
+            const auto &segment_shm = driver->get_shm(i);
+            prepare_memory(segment_shm.get_addr<void *>(),
+                           segment_shm.get_size(),
+                           segment_shm.get_name(),
+                           ARG_HUGEPAGES,
+                           ARG_PREFAULT);
+        }
+
+        std::cerr << "INFO: Writing " << driver->size() << " shared memories";
+        if (driver->get_period().count()) std::cerr << " (tick period: " << driver->get_period().count() << " ns)";
+        std::cerr << '.' << '\n';
+
+        std::size_t counter       = 0;
+        std::size_t due_intervals = 0;
+        while (true) {
+            filler->set_generation(generation++);
+            try {
+                driver->tick(*filler, scheduler->next_tick());
+            } catch (const std::system_error &e) {
+                std::cerr << e.what() << '\n';
+                return EX_OSERR;
+            }
+            if (driver->failed()) break;
+
+            if (due_intervals == 0) {
+                try {
+                    due_intervals = scheduler->wait();
+                } catch (const std::system_error &e) {
+                    std::cerr << e.what() << '\n';
+                    return EX_OSERR;
+                }
+                if (due_intervals == 0) break;
+            }
+            --due_intervals;
+
+            if (interval_counter && ++counter >= interval_counter) break;
+        }
+
+        std::cerr << "Terminating..." << '\n';
+        return EX_OK;
+    }
+
+    std::uint32_t frame_count = 0;
+    if (args.count("frames") > 1) {
+        std::cerr << "multiple definitions of '--frames' are not allowed." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    } else if (args.count("frames")) {
+        frame_count = args["frames"].as<std::uint32_t>();
+        if (frame_count < 2) {
+            std::cerr << frame_count << " is not a valid value for '--frames'" << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        if (args.count("sync") || args.count("semaphore")) {
+            std::cerr << "'--frames' can not be combined with '--sync' or '--semaphore'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+    }
+
+    double               update_fraction = 1;
+    UpdateWindow::mode_t window_mode     = UpdateWindow::mode_t::SLIDING;
+    if (args.count("update-fraction") > 1 || args.count("window") > 1) {
+        std::cerr << "multiple definitions of '--update-fraction' or '--window' are not allowed." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    } else if (args.count("update-fraction")) {
+        update_fraction = args["update-fraction"].as<double>();
+        if (!(update_fraction > 0 && update_fraction <= 1)) {
+            std::cerr << update_fraction << " is not a valid value for '--update-fraction'" << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        if (frame_count || args.count("prebuffer")) {
+            std::cerr << "'--update-fraction' can not be combined with '--frames' or '--prebuffer'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+    }
+    if (args.count("window") && !(update_fraction < 1)) {
+        std::cerr << "'--window' requires '--update-fraction' with a value less than 1." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    double rate = 0;
+    if (ARG_RATE) {
+        if (args.count("rate") + args.count("updates-per-sec") > 1) {
+            std::cerr << "multiple definitions of '--rate' or '--updates-per-sec' are not allowed." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        for (const char *option :
+             {"frames", "prebuffer", "update-fraction", "region", "region-file", "replay", "record"}) {
+            if (args.count(option)) {
+                std::cerr << "'--" << option << "' can not be combined with '--rate' or '--updates-per-sec'." << '\n';
+                std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+                return EX_USAGE;
+            }
+        }
+        if (args.count("sync") && args["sync"].as<std::string>() == "stripes") {
+            std::cerr << "'--sync stripes' can not be combined with '--rate' or '--updates-per-sec'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        if (period.count() == 0) {
+            std::cerr << "'--rate' and '--updates-per-sec' require an interval greater than 0." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        try {
+            rate = args.count("rate") ? parse_rate(args["rate"].as<std::string>())
+                                      : args["updates-per-sec"].as<double>() * static_cast<double>(alignment);
+        } catch (const std::invalid_argument &e) {
+            std::cerr << e.what() << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        if (!(rate > 0) || !std::isfinite(rate)) {
+            std::cerr << "the rate must be greater than 0." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+    }
+
+    try {
+        window_mode = parse_window_mode(args["window"].as<std::string>());
+    } catch (const std::invalid_argument &) {
+        std::cerr << '\'' << args["window"].as<std::string>() << "' is not a valid value for '--window'" << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    std::vector<RegionSpec> region_specs;
+    try {
+        if (args.count("region")) {
+            for (const auto &spec : args["region"].as<std::vector<std::string>>())
+                region_specs.push_back(parse_region(spec));
+        }
+        if (args.count("region-file") > 1) {
+            std::cerr << "multiple definitions of '--region-file' are not allowed." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        } else if (args.count("region-file")) {
+            const auto file_regions = read_region_file(args["region-file"].as<std::string>());
+            region_specs.insert(region_specs.end(), file_regions.begin(), file_regions.end());
+        }
+    } catch (const std::invalid_argument &e) {
+        std::cerr << e.what() << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    } catch (const std::runtime_error &e) {
+        std::cerr << e.what() << '\n';
+        return EX_NOINPUT;
+    }
+
+    if (!region_specs.empty()) {
+        if (args.count("offset") || args.count("elements") || args.count("alignment") || args.count("mask")) {
+            std::cerr << "regions can not be combined with '--offset', '--elements', '--alignment' or '--mask'."
+                      << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        if (distribution) {
+            std::cerr << "regions can not be combined with '--distribution'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        if (frame_count || args.count("prebuffer") || args.count("update-fraction")) {
+            std::cerr << "regions can not be combined with '--frames', '--prebuffer' or '--update-fraction'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        // one shot: write every region once
+        if (interval_counter == 1) {
+            for (auto &spec : region_specs)
+                spec.interval.reset();
+        }
+    }
+
+    const bool ARG_REPLAY = args.count("replay");
+    if (ARG_REPLAY) {
+        if (args.count("replay") > 1) {
+            std::cerr << "multiple definitions of '--replay' are not allowed." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        for (const char *option : {"mask", "distribution", "seed", "prebuffer", "update-fraction"}) {
+            if (args.count(option)) {
+                std::cerr << "'--replay' can not be combined with '--" << option << "'." << '\n';
+                std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+                return EX_USAGE;
+            }
+        }
+        if (!region_specs.empty()) {
+            std::cerr << "regions can not be combined with '--replay'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        if (args["replay-buffer"].as<std::size_t>() == 0) {
+            std::cerr << "0 is not a valid value for '--replay-buffer'" << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+    } else if (args.count("replay-once")) {
+        std::cerr << "'--replay-once' requires '--replay'." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    enum class record_t { RAW, GENERATION } record_format = record_t::RAW;
+    const bool ARG_RECORD                                  = args.count("record");
+    if (ARG_RECORD) {
+        if (args.count("record") > 1 || args.count("record-format") > 1) {
+            std::cerr << "multiple definitions of '--record' or '--record-format' are not allowed." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        if (!region_specs.empty()) {
+            std::cerr << "regions can not be combined with '--record'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        const auto tmp = args["record-format"].as<std::string>();
+        if (tmp == "generation") {
+            record_format = record_t::GENERATION;
+        } else if (tmp != "raw") {
+            std::cerr << '\'' << tmp << "' is not a valid value for '--record-format'" << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        // a partially updated frame depends on all previous generations (also if stripes are skipped)
+        const bool ARG_STRIPES = args.count("sync") && args["sync"].as<std::string>() == "stripes";
+        if (record_format == record_t::GENERATION &&
+            (!ARG_SEED || args.count("update-fraction") || ARG_REPLAY || ARG_STRIPES)) {
+            std::cerr << "'--record-format generation' requires '--seed' "
+                         "and can not be combined with '--update-fraction', '--replay' or '--sync stripes'."
+                      << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+    } else if (args.count("record-buffer") || args.count("record-format")) {
+        std::cerr << "'--record-buffer' and '--record-format' require '--record'." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    std::unique_ptr<cxxshm::SharedMemory> shm;
+    const bool                            ARG_CREATE        = args.count("create");
+    const bool                            ARG_REATTACH      = args.count("reattach");
+    pid_t                                 shm_owner_pid     = 0;
+    bool                                  use_shm_owner_pid = false;
+
+    if (ARG_REATTACH && (ARG_CREATE || args.count("pid"))) {
+        std::cerr << "'--reattach' can not be combined with '--create' or '--pid'." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    }
+
+    if (ARG_CREATE) {
+        const auto shm_size      = args["create"].as<std::size_t>();
+        const auto shm_exclusive = !args.count("force");
+        const auto shm_mode_str  = args["permissions"].as<std::string>();
+
+        mode_t      mode = 0;
+        bool        fail = false;
+        std::size_t idx  = 0;
+        try {
+            mode = static_cast<decltype(mode)>(std::stoul(shm_mode_str, &idx, 0));
+        } catch (const std::exception &) { fail = true; }
+        fail = fail || idx != shm_mode_str.size();
+
+        if (fail) throw std::invalid_argument("Failed to parse permissions '" + shm_mode_str + '\'');
+
+        std::size_t shm_total_size = shm_size;
+        if (frame_count) {
+            try {
+                shm_total_size = FrameRing::required_size(shm_size, frame_count);
+            } catch (const std::invalid_argument &e) {
+                std::cerr << e.what() << '\n';
+                std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+                return EX_USAGE;
+            }
+        }
+
+        try {
+            shm = std::make_unique<cxxshm::SharedMemory>(shm_name, shm_total_size, false, shm_exclusive, mode);
+        } catch (std::exception &e) {
+            std::cerr << e.what() << '\n';
+            return EX_OSERR;
+        }
+
+        if (frame_count) FrameRing::initialize(shm->get_addr<void *>(), shm->get_size(), shm_size, frame_count);
+    } else {
+        try {
+            shm = std::make_unique<cxxshm::SharedMemory>(shm_name);
+        } catch (std::exception &e) {
+            std::cerr << e.what() << '\n';
+            return EX_OSERR;
+        }
+
+        if (args.count("pid") == 0) {
+            if (interval_counter != 1 && !ARG_REATTACH) {
+                std::cerr << "Warning: No SHM owner PID provided.\n"
+                             "         This application is NOT terminated if the owner of the shared memory closes the "
+                             "shared memory.\n"
+                             "         This application WILL NOT reconnect to the shared memory if it is recreated.\n"
+                             "         Use --pid to specify the PID of the SHM owner or --reattach to reconnect.\n";
+                std::cerr << std::flush;
+            }
+        } else {
+            if (interval_counter != 1) {
+                shm_owner_pid     = args["pid"].as<pid_t>();
+                use_shm_owner_pid = true;
+            }
+        }
+    }
+
+    std::unique_ptr<FrameRing> frame_ring;
+    if (frame_count) {
+        try {
+            frame_ring = std::make_unique<FrameRing>(shm->get_addr<void *>(), shm->get_size());
+        } catch (const std::runtime_error &e) {
+            std::cerr << e.what() << '\n';
+            return EX_DATAERR;
+        }
+
+        if (frame_ring->get_frames() != frame_count) {
+            std::cerr << "the shared memory contains " << frame_ring->get_frames() << " frames, not " << frame_count
+                      << '.' << '\n';
+            return EX_DATAERR;
+        }
+    }
+
+    // with --frames, offset and number of elements refer to a single frame
+    const auto DATA_SIZE = frame_ring ? frame_ring->get_frame_size() : shm->get_size();
+    const auto OFFSET    = args["offset"].as<std::size_t>();
+    const auto SIZE      = OFFSET > DATA_SIZE ? 0 : (DATA_SIZE - OFFSET);
+
+    std::cerr << "INFO: Opened shared memory '" << shm_name << "'. Size: " << shm->get_size()
+              << (shm->get_size() != 1 ? " bytes" : " byte") << '.';
+    if (frame_ring) std::cerr << " (" << frame_count << " frames of " << DATA_SIZE << " bytes)";
+    if (OFFSET) std::cerr << " (Effective size: " << SIZE << (SIZE != 1 ? " bytes" : " byte") << ")";
+    std::cerr << '\n';
+
+    prepare_memory(shm->get_addr<void *>(), shm->get_size(), shm_name, ARG_HUGEPAGES, ARG_PREFAULT);
+
+    if (OFFSET % alignment != 0) {
+        std::cerr << "WARNING: Invalid alignment detected. Performance issues possible." << '\n';
+        if (distribution && filler->get_store() != ParallelFill::store_t::CACHED)
+            std::cerr << "WARNING: The elements are not aligned to their size. "
+                         "Non-temporal stores are not used."
+                      << '\n';
+    }
+
+    std::size_t shm_elements = SIZE / static_cast<std::size_t>(alignment);
+    if (args.count("elements")) { shm_elements = std::min(shm_elements, args["elements"].as<std::size_t>()); }
+
+    std::unique_ptr<RegionSet> regions;
+    if (!region_specs.empty()) {
+        try {
+            regions = std::make_unique<RegionSet>(region_specs, shm->get_size(), period);
+        } catch (const std::invalid_argument &e) {
+            std::cerr << e.what() << '\n';
+            return EX_DATAERR;
+        }
+        period = regions->get_period();
+        std::cerr << "INFO: Writing " << regions->size() << " regions";
+        if (period.count()) std::cerr << " (tick period: " << period.count() << " ns)";
+        std::cerr << '.' << '\n';
+    }
+
+    // the default timeouts refer to the tick period, which is shorter than the interval for regions
+    if (!args.count("semaphore-timeout")) semaphore_policy.timeout = period / 2;
+    if (!args.count("stripe-timeout") && period.count()) stripe_timeout = period / 2;
+
+    if (shm_elements == 0 && !regions) {
+        std::cerr << "no elements to work on. (Either is the shared memory to small to create at least one element ";
+        std::cerr << "with the specified allignment or the parameter elements is 0.)" << '\n';
+        return EX_DATAERR;
+    }
+    const auto data_size = shm_elements * alignment;
+
+    // one shot: fault in the written pages with a single system call (as MAP_POPULATE) instead of one fault per page
+    if (interval_counter == 1 && !ARG_PREFAULT && !frame_ring && !regions) {
+        static const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        const auto        first     = OFFSET / page_size * page_size;
+        prefault_memory(shm->get_addr<std::uint8_t *>() + first, OFFSET + data_size - first);
+    }
+
+    enum class sync_t { NONE, SEMAPHORE, SEQLOCK, STRIPES } sync_type = sync_t::NONE;
+    if (args.count("sync") > 1) {
+        std::cerr << "multiple definitions of '--sync' are not allowed." << '\n';
+        std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+        return EX_USAGE;
+    } else if (args.count("sync")) {
+        const auto tmp = args["sync"].as<std::string>();
+        if (tmp == "semaphore") {
+            sync_type = sync_t::SEMAPHORE;
+        } else if (tmp == "seqlock") {
+            sync_type = sync_t::SEQLOCK;
+        } else if (tmp == "stripes") {
+            sync_type = sync_t::STRIPES;
+        } else {
+            std::cerr << '\'' << tmp << "' is not a valid value for '--sync'" << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+    } else if (args.count("semaphore")) {
+        sync_type = sync_t::SEMAPHORE;
+    }
+
+    std::unique_ptr<FrameSync>   sync;
+    FrameRing                   *frames         = frame_ring.get();
+    SemaphoreSync               *semaphore_sync = nullptr;
+    std::unique_ptr<StripeLocks> stripe_locks;
+    const auto                   sync_offset      = args["sync-offset"].as<std::size_t>();
+    std::size_t                  sync_header_size = 0;
+
+    // check if a header overlaps with the random data
+    auto overlaps_data = [&](std::size_t offset, std::size_t size) {
+        if (frames) return offset < FrameRing::required_size(frames->get_frame_size(), frames->get_frames());
+        if (regions) return regions->overlaps(offset, size);
+        return OFFSET < offset + size && offset < OFFSET + data_size;
+    };
+
+    if (frame_ring) {
+        sync = std::move(frame_ring);
+    } else if (sync_type == sync_t::SEMAPHORE) {
+        if (!args.count("semaphore")) {
+            std::cerr << "'--sync semaphore' requires '--semaphore'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        const auto semaphore_name = args["semaphore"].as<std::string>();
+
+        std::unique_ptr<cxxsemaphore::Semaphore> semaphore;
+        try {
+            if (ARG_CREATE) {
+                const bool force = args.count("semaphore-force");
+                semaphore        = std::make_unique<cxxsemaphore::Semaphore>(semaphore_name, 1, force);
+            } else {
+                semaphore = std::make_unique<cxxsemaphore::Semaphore>(semaphore_name);
+            }
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << '\n';
+            return EX_SOFTWARE;
+        }
+
+        auto tmp       = std::make_unique<SemaphoreSync>(std::move(semaphore), semaphore_policy);
+        semaphore_sync = tmp.get();
+        sync           = std::move(tmp);
+    } else if (sync_type == sync_t::SEQLOCK) {
+        if (args.count("semaphore")) {
+            std::cerr << "'--semaphore' can not be combined with '--sync seqlock'." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+        if (sync_offset + SeqlockSync::HEADER_SIZE > shm->get_size()) {
+            std::cerr << "the seqlock header does not fit into the shared memory." << '\n';
+            return EX_DATAERR;
+        }
+        if (overlaps_data(sync_offset, SeqlockSync::HEADER_SIZE)) {
+            std::cerr << "the seqlock header overlaps with the random data. Use '--offset' or '--sync-offset'." << '\n';
+            return EX_USAGE;
+        }
+
+        try {
+            sync = std::make_unique<SeqlockSync>(shm->get_addr<uint8_t *>() + sync_offset);
+        } catch (const std::invalid_argument &e) {
+            std::cerr << e.what() << '\n';
+            return EX_USAGE;
+        }
+        sync_header_size = SeqlockSync::HEADER_SIZE;
+    } else if (sync_type == sync_t::STRIPES) {
+        for (const char *option : {"semaphore", "prebuffer", "update-fraction", "region", "region-file", "replay"}) {
+            if (args.count(option)) {
+                std::cerr << "'--" << option << "' can not be combined with '--sync stripes'." << '\n';
+                std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+                return EX_USAGE;
+            }
+        }
+
+        const auto table_size = StripeLocks::table_size(data_size, stripe_size);
+        if (sync_offset + table_size > shm->get_size()) {
+            std::cerr << "the stripe lock table (" << table_size << " bytes) does not fit into the shared memory."
+                      << '\n';
+            return EX_DATAERR;
+        }
+        if (overlaps_data(sync_offset, table_size)) {
+            std::cerr << "the stripe lock table overlaps with the random data. Use '--offset' or '--sync-offset'."
+                      << '\n';
+            return EX_USAGE;
+        }
+
+        try {
+            stripe_locks = std::make_unique<StripeLocks>(
+                    shm->get_addr<uint8_t *>() + sync_offset, OFFSET, data_size, stripe_size);
+        } catch (const std::invalid_argument &e) {
+            std::cerr << e.what() << '\n';
+            return EX_USAGE;
+        }
+        std::cerr << "INFO: " << stripe_locks->get_stripes() << " stripes of " << stripe_size << " bytes." << '\n';
+        sync_header_size = table_size;
+    } else {
+        std::cerr << "WARNING: No semaphore specified.\n"
+                     "         Concurrent access to the shared memory is possible.\n"
+                     "         This can result in CORRUPTED DATA.\n"
+                     "         Use --semaphore to specify a semaphore.\n";
+        std::cerr << std::flush;
+    }
+
+    std::unique_ptr<FrameNotify> notify;
+    const auto                   notify_offset = args.count("notify") ? args["notify"].as<std::size_t>() : 0;
+    if (args.count("notify")) {
+        if (notify_offset + FrameNotify::HEADER_SIZE > shm->get_size()) {
+            std::cerr << "the notification header does not fit into the shared memory." << '\n';
+            return EX_DATAERR;
+        }
+        if (overlaps_data(notify_offset, FrameNotify::HEADER_SIZE) ||
+            (sync_header_size && notify_offset < sync_offset + sync_header_size &&
+             sync_offset < notify_offset + FrameNotify::HEADER_SIZE)) {
+            std::cerr << "the notification header overlaps with the random data or the synchronization header."
+                      << '\n';
+            return EX_USAGE;
+        }
+
+        try {
+            notify = std::make_unique<FrameNotify>(shm->get_addr<uint8_t *>() + notify_offset);
+        } catch (const std::invalid_argument &e) {
+            std::cerr << e.what() << '\n';
+            return EX_USAGE;
+        }
+    }
+
+    // interval timer (not required for a one shot run)
+    std::unique_ptr<Scheduler> scheduler;
+    try {
+        if (interval_counter != 1) scheduler = std::make_unique<Scheduler>(period, overrun);
+    } catch (const std::system_error &e) {
+        std::cerr << e.what() << '\n';
+        return EX_OSERR;
+    }
+
+    // MAIN loop
+    std::size_t counter = 0;
+
+    auto handle_counter = [&]() {
+        if (interval_counter) {
             if (++counter >= interval_counter) return true;
         }
         return false;
     };
 
+    // the owner is watched via pidfd by the scheduler, kill(pid, 0) is only used if pidfds are not supported
+    if (use_shm_owner_pid) {
+        try {
+            scheduler->watch_process(shm_owner_pid);
+            use_shm_owner_pid = false;
+        } catch (const std::system_error &e) {
+            if (e.code().value() == ESRCH) {
+                std::cerr << "SHM owner (pid=" << shm_owner_pid << ") no longer alive.\n" << std::flush;
+                return EX_OK;
+            }
+            if (e.code().value() != ENOSYS) {
+                std::cerr << e.what() << '\n';
+                return EX_OSERR;
+            }
+            std::cerr << "WARNING: pidfd is not supported. The SHM owner is checked after every interval." << '\n';
+        }
+    }
+
     auto check_owner_pid = [&]() {
         if (!use_shm_owner_pid) return false;
 
@@ -394,57 +1805,338 @@ int main(int argc, char **argv) {  // NOLINT
         return false;
     };
 
+    // number of intervals that are due (> 1 only with overrun policy catch-up)
+    std::size_t due_intervals = 0;
+
     auto handle_sleep = [&]() {
-        if (random_interval_ms == 0) return false;
+        if (!scheduler) return true;
 
-        int  sig = 0;
-        auto tmp = sigwait(&sleep_sigset, &sig);
-        if (tmp == -1) {
-            perror("sigwait");
-            exit(EX_OSERR);
+        if (due_intervals == 0) {
+            try {
+                due_intervals = scheduler->wait();
+            } catch (const std::system_error &e) {
+                std::cerr << e.what() << '\n';
+                exit(EX_OSERR);
+            }
+            if (due_intervals == 0) return true;
         }
 
-        return sig != SIGALRM;
+        --due_intervals;
+        return false;
     };
 
-    switch (alignment) {
-        case BYTE:
-            while (!terminate) {
-                random_data<uint8_t>(
-                        shm->get_addr<uint8_t *>() + OFFSET, shm_elements, bitmask, semaphore, semaphore_max_time);
-                if (handle_sleep()) break;
-                if (handle_counter()) break;
-                if (check_owner_pid()) break;
+    const LaneMask lane_mask(bitmask, alignment);
+
+    std::unique_ptr<StatsExport> stats;
+    if (args.count("export-stats")) {
+        try {
+            stats = std::make_unique<StatsExport>(shm_name);
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << '\n';
+            return EX_OSERR;
+        }
+        std::cerr << "INFO: Exporting statistics via shared memory '" << StatsExport::stats_name(shm_name) << "'."
+                  << '\n';
+        stats->set_perf(perf.get());
+    }
+
+    std::unique_ptr<PrivateBuffer> prebuffer;
+    if (args.count("prebuffer")) {
+        try {
+            prebuffer = std::make_unique<PrivateBuffer>(data_size);
+        } catch (const std::system_error &e) {
+            std::cerr << e.what() << '\n';
+            return EX_OSERR;
+        }
+        prepare_memory(prebuffer->get_addr(), data_size, "prebuffer", ARG_HUGEPAGES, ARG_PREFAULT);
+        filler->set_generation(generation);
+        filler->fill(prebuffer->get_addr(), data_size, lane_mask);
+    }
+
+    std::unique_ptr<UpdateWindow> window;
+    if (update_fraction < 1) {
+        const auto window_seed = ARG_SEED ? derive_seed(seed, 0, ~static_cast<std::uint64_t>(0), 0) : entropy_seed();
+        window = std::make_unique<UpdateWindow>(data_size, update_fraction, window_mode, window_seed);
+    }
+
+    std::unique_ptr<RatePacer> pacer;
+    if (ARG_RATE) {
+        pacer = std::make_unique<RatePacer>(data_size, rate, period, alignment);
+        std::cerr << "INFO: Target rate: " << static_cast<std::uint64_t>(rate) << " bytes/s ("
+                  << static_cast<std::uint64_t>(rate * std::chrono::duration<double>(period).count())
+                  << " bytes per interval)." << '\n';
+    }
+
+    // opening a FIFO blocks until the writer is connected
+    std::unique_ptr<ReplaySource> replay;
+    if (ARG_REPLAY) {
+        const auto path = args["replay"].as<std::string>();
+        try {
+            replay = open_replay(
+                    path, data_size, args["replay-buffer"].as<std::size_t>(), !args.count("replay-once"));
+        } catch (const std::system_error &e) {
+            std::cerr << e.what() << '\n';
+            return EX_NOINPUT;
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << '\n';
+            return EX_DATAERR;
+        }
+
+        std::cerr << "INFO: Replaying '" << path << "' (frame size: " << data_size << " bytes";
+        if (const auto *mapped = dynamic_cast<const MappedReplay *>(replay.get()))
+            std::cerr << ", " << mapped->get_frames() << " frames";
+        std::cerr << ")." << '\n';
+    }
+
+    std::unique_ptr<Recorder> recorder;
+    if (ARG_RECORD) {
+        static constexpr std::size_t DEFAULT_RECORD_BUFFER = 64 * 1024 * 1024;
+        static constexpr std::size_t MAX_DEFAULT_BUFFER    = 1024 * 1024 * 1024;
+        static constexpr std::size_t RECORD_FRAMES         = 8;
+
+        const auto path = args["record"].as<std::string>();
+        auto       buffer_size =
+                std::max(data_size, std::clamp(RECORD_FRAMES * data_size, DEFAULT_RECORD_BUFFER, MAX_DEFAULT_BUFFER));
+        if (record_format == record_t::GENERATION) buffer_size = DEFAULT_RECORD_BUFFER;
+        if (args.count("record-buffer")) buffer_size = args["record-buffer"].as<std::size_t>();
+
+        if (record_format == record_t::RAW && buffer_size < data_size) {
+            std::cerr << "the record buffer is smaller than one frame (" << data_size << " bytes)." << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        const auto pages     = sysconf(_SC_PHYS_PAGES);
+        const auto page_size = sysconf(_SC_PAGESIZE);
+        if (pages > 0 && page_size > 0 &&
+            buffer_size / static_cast<std::size_t>(page_size) > static_cast<std::size_t>(pages) / 2) {
+            std::cerr << "the record buffer (" << buffer_size << " bytes) is larger than half of the physical memory."
+                      << '\n';
+            std::cerr << "Use '" << exe_name << " --help' for more information." << '\n';
+            return EX_USAGE;
+        }
+
+        try {
+            recorder = std::make_unique<Recorder>(path, buffer_size);
+        } catch (const std::system_error &e) {
+            std::cerr << e.what() << '\n';
+            return EX_CANTCREAT;
+        }
+
+        if (record_format == record_t::GENERATION) {
+            const auto header = "# shared-mem-random generation log (generation, CLOCK_REALTIME ns)\nseed " +
+                                std::to_string(seed) + " size " + std::to_string(data_size) + " offset " +
+                                std::to_string(OFFSET) + '\n';
+            recorder->record(header.data(), header.size());
+        }
+
+        std::cerr << "INFO: Recording to '" << path << '\'' << (recorder->is_direct() ? " (O_DIRECT)" : "") << '.'
+                  << '\n';
+    }
+
+    // record a published frame
+    auto record_frame = [&](const std::uint8_t *data, std::uint64_t frame_generation) {
+        if (record_format == record_t::RAW) {
+            // copied by the writer thread, the next fill waits for the copy
+            recorder->record_async(data, data_size);
+            return;
+        }
+
+        static constexpr std::size_t LINE_SIZE = 48;
+        std::array<char, LINE_SIZE>  line {};
+        const auto                   time = std::chrono::system_clock::now().time_since_epoch();
+        // uint64 and int64 have at most 20 characters each
+        auto *end = std::to_chars(line.data(), line.data() + line.size() / 2, frame_generation).ptr;
+        *end++    = ' ';
+        end       = std::to_chars(end, line.data() + line.size() - 1, std::chrono::nanoseconds(time).count()).ptr;
+        *end++    = '\n';
+        recorder->record(line.data(), static_cast<std::size_t>(end - line.data()));
+    };
+
+    bool          initialized     = false;
+    std::uint64_t skipped_stripes = 0;
+
+    // reattach to recreated shared memory / semaphore
+    std::unique_ptr<ShmWatch> watch;
+    std::size_t               watch_shm       = 0;
+    std::size_t               watch_semaphore = 0;
+    bool                      reattach_warned = false;
+    if (ARG_REATTACH && scheduler) {
+        try {
+            watch     = std::make_unique<ShmWatch>();
+            watch_shm = watch->add(ShmWatch::shm_file(shm_name), shm->get_fd());
+            if (semaphore_sync)
+                watch_semaphore = watch->add(ShmWatch::semaphore_file(args["semaphore"].as<std::string>()));
+            scheduler->add_event_fd(watch->get_fd());
+        } catch (const std::system_error &e) {
+            std::cerr << e.what() << '\n';
+            return EX_OSERR;
+        }
+    }
+
+    // returns false if the application has to be terminated
+    auto reattach = [&]() {
+        if (watch->is_recreated(watch_shm)) {
+            std::unique_ptr<cxxshm::SharedMemory> new_shm;
+            std::unique_ptr<FrameSync>            new_sync;
+            std::unique_ptr<StripeLocks>          new_locks;
+            try {
+                new_shm = std::make_unique<cxxshm::SharedMemory>(shm_name);
+                if (new_shm->get_size() != shm->get_size()) {
+                    std::cerr << "ERROR: The recreated shared memory '" << shm_name << "' has a different size ("
+                              << new_shm->get_size() << " bytes instead of " << shm->get_size() << " bytes)." << '\n';
+                    return false;
+                }
+
+                if (frames) {
+                    auto ring = std::make_unique<FrameRing>(new_shm->get_addr<void *>(), new_shm->get_size());
+                    frames    = ring.get();
+                    new_sync  = std::move(ring);
+                } else if (sync_type == sync_t::SEQLOCK) {
+                    new_sync = std::make_unique<SeqlockSync>(new_shm->get_addr<uint8_t *>() + sync_offset);
+                } else if (stripe_locks) {
+                    new_locks = std::make_unique<StripeLocks>(
+                            new_shm->get_addr<uint8_t *>() + sync_offset, OFFSET, data_size, stripe_size);
+                }
+            } catch (const std::exception &e) {
+                // probably not yet initialized by the owner: retry after the next interval
+                if (!reattach_warned) std::cerr << "WARNING: Failed to reattach: " << e.what() << '\n';
+                reattach_warned = true;
+                return true;
             }
-            break;
-        case WORD:
-            while (!terminate) {
-                random_data<uint16_t>(
-                        shm->get_addr<uint8_t *>() + OFFSET, shm_elements, bitmask, semaphore, semaphore_max_time);
-                if (handle_sleep()) break;
-                if (handle_counter()) break;
-                if (check_owner_pid()) break;
+
+            prepare_memory(new_shm->get_addr<void *>(), new_shm->get_size(), shm_name, ARG_HUGEPAGES, ARG_PREFAULT);
+            if (new_sync) sync = std::move(new_sync);
+            if (new_locks) stripe_locks = std::move(new_locks);
+            if (notify) notify = std::make_unique<FrameNotify>(new_shm->get_addr<uint8_t *>() + notify_offset);
+            shm = std::move(new_shm);
+            watch->update(watch_shm, shm->get_fd());
+            reattach_warned = false;
+            initialized     = false;  // write the entire memory area
+            std::cerr << "INFO: Reattached to shared memory '" << shm_name << "'." << '\n';
+        }
+
+        if (semaphore_sync && watch->is_recreated(watch_semaphore)) {
+            const auto name = args["semaphore"].as<std::string>();
+            try {
+                semaphore_sync->set_semaphore(std::make_unique<cxxsemaphore::Semaphore>(name));
+                watch->update(watch_semaphore);
+            } catch (const std::exception &e) {
+                if (!reattach_warned) std::cerr << "WARNING: Failed to reattach: " << e.what() << '\n';
+                reattach_warned = true;
+                return true;
             }
-            break;
-        case DWORD:
-            while (!terminate) {
-                random_data<uint32_t>(
-                        shm->get_addr<uint8_t *>() + OFFSET, shm_elements, bitmask, semaphore, semaphore_max_time);
-                if (handle_sleep()) break;
-                if (handle_counter()) break;
-                if (check_owner_pid()) break;
+            std::cerr << "INFO: Reattached to semaphore '" << name << "'." << '\n';
+        }
+
+        return true;
+    };
+
+    while (true) {
+        // the last recorded frame must not be overwritten before it was copied
+        if (recorder) recorder->wait();
+
+        // the prebuffer is refilled for the next generation (only if the frame is published)
+        filler->set_generation(prebuffer ? generation + 1 : generation);
+
+        if (scheduler && semaphore_sync && semaphore_policy.strategy == SemaphoreSync::strategy_t::DEADLINE) {
+            try {
+                semaphore_sync->set_deadline(scheduler->next_tick());
+            } catch (const std::system_error &e) {
+                std::cerr << e.what() << '\n';
+                return EX_OSERR;
             }
-            break;
-        case QWORD:
-            while (!terminate) {
-                random_data<uint64_t>(
-                        shm->get_addr<uint8_t *>() + OFFSET, shm_elements, bitmask, semaphore, semaphore_max_time);
-                if (handle_sleep()) break;
-                if (handle_counter()) break;
-                if (check_owner_pid()) break;
+        }
+
+        auto *frame = frames ? frames->back_frame() : shm->get_addr<uint8_t *>();
+        bool published;
+        if (replay) {
+            published = replay_data(frame + OFFSET, *replay, *filler, sync.get(), stats.get());
+            if (!published && replay->finished()) break;
+        } else if (prebuffer) {
+            published =
+                    prebuffered_random_data(frame + OFFSET, *prebuffer, lane_mask, *filler, sync.get(), stats.get());
+        } else if (regions) {
+            published = region_random_data(frame, *regions, *filler, sync.get(), stats.get());
+        } else if (stripe_locks) {
+            const auto skipped = striped_random_data(
+                    frame + OFFSET, data_size, lane_mask, *filler, *stripe_locks, stripe_timeout, stats.get());
+            skipped_stripes += skipped;
+            published = skipped < stripe_locks->get_stripes();
+        } else if (pacer) {
+            published = paced_random_data(frame + OFFSET, *pacer, lane_mask, *filler, sync.get(), stats.get());
+        } else if (window && initialized) {
+            published = partial_random_data(frame + OFFSET, *window, lane_mask, *filler, sync.get(), stats.get());
+        } else {
+            published = random_data(frame + OFFSET, data_size, lane_mask, *filler, sync.get(), stats.get());
+        }
+        initialized = initialized || published;
+        if (notify && published) notify->notify();
+        if (recorder && published) record_frame(frame + OFFSET, generation);
+        if (published) ++generation;
+        if (stats) stats->update(scheduler ? scheduler->get_missed() : 0, sync ? sync->get_error_counter() : 0);
+        if (stats && pacer) stats->update_rate(pacer->get_target_rate(), pacer->get_achieved_rate());
+        if (sync && sync->failed()) break;
+        if (handle_sleep()) break;
+        if (handle_counter()) break;
+        if (check_owner_pid()) break;
+
+        if (watch) {
+            try {
+                if (scheduler->take_event()) watch->poll();
+            } catch (const std::system_error &e) {
+                std::cerr << e.what() << '\n';
+                return EX_OSERR;
             }
-            break;
+            if (watch->pending() && !reattach()) return EX_DATAERR;
+        }
     }
 
+    int exit_code = EX_OK;
+
+    if (replay) {
+        if (replay->get_error()) {
+            std::cerr << "ERROR: Failed to read the replay input: "
+                      << std::generic_category().message(replay->get_error()) << '\n';
+            exit_code = EX_IOERR;
+        }
+        if (replay->get_underruns())
+            std::cerr << "WARNING: " << replay->get_underruns()
+                      << " intervals were skipped because no replay data was available." << '\n';
+    }
+
+    if (recorder) {
+        recorder->finish();
+        if (recorder->get_error()) {
+            std::cerr << "ERROR: Failed to write the record file: "
+                      << std::generic_category().message(recorder->get_error()) << '\n';
+            exit_code = EX_IOERR;
+        }
+        if (recorder->get_dropped())
+            std::cerr << "WARNING: " << recorder->get_dropped()
+                      << " frames were not recorded because the record buffer was full." << '\n';
+    }
+
+    if (pacer) {
+        std::cerr << "INFO: Achieved rate: " << static_cast<std::uint64_t>(pacer->get_achieved_rate())
+                  << " bytes/s (target: " << static_cast<std::uint64_t>(pacer->get_target_rate()) << " bytes/s)."
+                  << '\n';
+    }
+
+    if (skipped_stripes)
+        std::cerr << "WARNING: " << skipped_stripes << " stripes were skipped because they were locked by a reader."
+                  << '\n';
+
+    if (semaphore_sync && semaphore_sync->get_skipped())
+        std::cerr << "WARNING: " << semaphore_sync->get_skipped()
+                  << " frames were skipped because the semaphore was not available." << '\n';
+
+    if (scheduler && scheduler->process_exited())
+        std::cerr << "SHM owner (pid=" << shm_owner_pid << ") no longer alive.\n" << std::flush;
+
+    if (scheduler && scheduler->get_missed())
+        std::cerr << "WARNING: " << scheduler->get_missed() << " intervals were skipped because of overruns." << '\n';
+
     std::cerr << "Terminating..." << '\n';
+    return exit_code;
 }
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "memory.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <sys/mman.h>
+#include <system_error>
+#include <unistd.h>
+
+#ifndef MADV_POPULATE_WRITE
+#    define MADV_POPULATE_WRITE 23  // NOLINT (Linux >= 5.14)
+#endif
+
+void advise_hugepages(void *addr, std::size_t size) {
+    if (madvise(addr, size, MADV_HUGEPAGE) == -1)
+        throw std::system_error(errno, std::generic_category(), "madvise(MADV_HUGEPAGE)");
+}
+
+void prefault_memory(void *addr, std::size_t size) {
+    if (madvise(addr, size, MADV_POPULATE_WRITE) == 0) return;
+
+    // fallback: touch every page without changing its content.
+    // An atomic add of 0 is a write access, but does not interfere with concurrent writers.
+    const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    auto      *bytes     = static_cast<std::uint8_t *>(addr);
+    for (std::size_t offset = 0; offset < size; offset += page_size)
+        std::atomic_ref<std::uint8_t>(bytes[offset]).fetch_add(0, std::memory_order_relaxed);
+}
+
+void lock_memory(void *addr, std::size_t size) {
+    if (mlock(addr, size) == -1) throw std::system_error(errno, std::generic_category(), "mlock");
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * \brief request transparent huge pages for a memory area (madvise MADV_HUGEPAGE)
+ * @details For shared memory objects, huge pages are only used if enabled for shmem
+ *          (/sys/kernel/mm/transparent_hugepage/shmem_enabled: advise or always).
+ * @param addr page aligned address of the memory area
+ * @param size size of the memory area in bytes
+ * @exception std::system_error madvise failed
+ */
+void advise_hugepages(void *addr, std::size_t size);
+
+/**
+ * \brief fault in all pages of a memory area (writable)
+ * @details Uses madvise MADV_POPULATE_WRITE. If not supported by the kernel, every page is touched instead
+ *          (the content of the memory area is not changed).
+ * @param addr page aligned address of the memory area
+ * @param size size of the memory area in bytes
+ */
+void prefault_memory(void *addr, std::size_t size);
+
+/**
+ * \brief lock all pages of a memory area in RAM (mlock)
+ * @param addr page aligned address of the memory area
+ * @param size size of the memory area in bytes
+ * @exception std::system_error mlock failed
+ */
+void lock_memory(void *addr, std::size_t size);
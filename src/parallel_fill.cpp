@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "parallel_fill.hpp"
+
+#include "stream.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+
+ParallelFill::ParallelFill(const std::string      &engine_name,
+                           std::size_t             threads,
+                           std::uint64_t           seed,
+                           const std::vector<int> &cpus,
+                           bool                    numa)
+    : pool(threads, cpus), numa(numa) {
+    set_store(store_t::AUTO);
+    SplitMix64 seed_gen(seed);
+    engines.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i)
+        engines.emplace_back(make_engine(engine_name, seed_gen()));
+    kernels = FillKernels(*engines.front());
+}
+
+void ParallelFill::set_store(store_t type, std::size_t threshold) noexcept {
+    store = type;
+    if (threshold == 0) threshold = last_level_cache_size();
+    stream_threshold = threshold ? threshold : DEFAULT_STREAM_THRESHOLD;
+}
+
+std::pair<std::size_t, std::size_t> ParallelFill::chunk(
+        const void *data, std::size_t size, std::size_t thread, std::size_t threads, std::size_t granularity) noexcept {
+    const auto base = reinterpret_cast<std::uintptr_t>(data);  // NOLINT
+
+    // split at cache line boundaries (absolute addresses) to avoid false sharing
+    auto boundary = [&](std::size_t index) -> std::size_t {
+        if (index == 0) return 0;
+        if (index >= threads) return size;
+        const auto addr    = base + size / threads * index;
+        const auto aligned = (addr + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+        const auto offset  = std::min(size, aligned - base);
+        return offset - offset % granularity;
+    };
+
+    return {boundary(thread), boundary(thread + 1)};
+}
+
+void ParallelFill::fill_part(std::size_t     thread,
+                             std::uint8_t   *data,
+                             range_t         part,
+                             const LaneMask &mask,
+                             bool            stream_store,
+                             std::uint64_t   stream_id) {
+    auto      &engine = *engines[thread];
+    const auto kernel = kernels.get(!mask.is_full(), stream_store);
+
+    auto write = [&](std::size_t offset, std::size_t length) {
+        if (distribution) fill_distribution(data + offset, length, *distribution, engine, offset, stream_store);
+        else kernel(data + offset, length, mask, engine, offset);
+    };
+
+    const auto [offset, length] = part;
+    if (!seed) {
+        write(offset, length);
+        return;
+    }
+
+    // reproducible mode: a new stream at every block boundary and at the start of the part
+    for (auto pos = offset; pos < offset + length;) {
+        const auto end = std::min(offset + length, (pos / STREAM_BLOCK_SIZE + 1) * STREAM_BLOCK_SIZE);
+        engine.seed(derive_seed(*seed, generation, stream_id, pos));
+        write(pos, end - pos);
+        pos = end;
+    }
+}
+
+bool ParallelFill::numa_first_use(const void *data, std::size_t size) {
+    if (!numa) return false;
+    const std::pair<const void *, std::size_t> area {data, size};
+    if (std::find(numa_areas.begin(), numa_areas.end(), area) != numa_areas.end()) return false;
+    numa_areas.push_back(area);
+    return true;
+}
+
+void ParallelFill::numa_bind(std::uint8_t *data, std::size_t size) noexcept {
+    const int node = current_numa_node();
+    if (node < 0 || !bind_numa_node(data, size, node)) numa_failed = true;
+}
+
+void ParallelFill::numa_report() noexcept {
+    if (numa_failed.exchange(false))
+        std::cerr << "WARNING: Failed to move the memory of at least one thread to its NUMA node." << '\n';
+}
+
+void ParallelFill::fill(void *data, std::size_t size, const LaneMask &mask, std::uint64_t stream_id) {
+    const auto threads = engines.size();
+    auto      *bytes   = static_cast<std::uint8_t *>(data);
+    const bool stream  = use_stream(size);
+
+    // reproducible mode: chunks consist of whole blocks, so the result does not depend on the number of threads
+    const auto granularity = seed ? STREAM_BLOCK_SIZE : distribution ? distribution->element_size() : 1;
+
+    // the workers place their chunks on their own NUMA node once per memory area
+    const bool bind = numa_first_use(data, size);
+
+    pool.run([&](std::size_t thread) {
+        const auto [begin, end] = chunk(data, size, thread, threads, granularity);
+        if (end <= begin) return;
+
+        if (bind) numa_bind(bytes + begin, end - begin);
+
+        fill_part(thread, bytes, {begin, end - begin}, mask, stream, stream_id);
+        if (stream) stream_fence();
+    });
+
+    numa_report();
+}
+
+void ParallelFill::fill_ranges(void                       *data,
+                               const std::vector<range_t> &ranges,
+                               const LaneMask             &mask,
+                               std::uint64_t               stream_id) {
+    const auto threads = engines.size();
+    auto      *bytes   = static_cast<std::uint8_t *>(data);
+
+    std::size_t total = 0;
+    for (const auto &range : ranges)
+        total += range.second;
+    const bool stream      = use_stream(total);
+    const auto granularity = distribution ? distribution->element_size() : 1;
+
+    // reproducible mode: split the ranges at block boundaries and distribute whole parts to the threads
+    const auto *work = &ranges;
+    if (seed) {
+        parts.clear();
+        for (const auto &[offset, length] : ranges) {
+            for (auto pos = offset; pos < offset + length;) {
+                const auto end = std::min(offset + length, (pos / STREAM_BLOCK_SIZE + 1) * STREAM_BLOCK_SIZE);
+                parts.emplace_back(pos, end - pos);
+                pos = end;
+            }
+        }
+        work = &parts;
+    }
+
+    pool.run([&](std::size_t thread) {
+        if (work->size() >= threads || seed) {
+            const auto first = work->size() * thread / threads;
+            const auto last  = work->size() * (thread + 1) / threads;
+            for (auto i = first; i < last; ++i)
+                fill_part(thread, bytes, (*work)[i], mask, stream, stream_id);
+        } else {
+            for (const auto &[offset, length] : ranges) {
+                const auto [begin, end] = chunk(bytes + offset, length, thread, threads, granularity);
+                if (end <= begin) continue;
+                fill_part(thread, bytes, {offset + begin, end - begin}, mask, stream, stream_id);
+            }
+        }
+        if (stream) stream_fence();
+    });
+}
+
+std::size_t ParallelFill::fill_striped(void                                   *data,
+                                       std::size_t                             size,
+                                       const LaneMask                         &mask,
+                                       StripeLocks                            &locks,
+                                       std::optional<std::chrono::nanoseconds> timeout) {
+    const auto threads = engines.size();
+    auto      *bytes   = static_cast<std::uint8_t *>(data);
+    const bool stream  = use_stream(size);
+
+    // every stripe is written by a single thread
+    const auto base_granularity = seed ? STREAM_BLOCK_SIZE : distribution ? distribution->element_size() : 1;
+    const auto granularity      = std::lcm(locks.get_stripe_size(), base_granularity);
+
+    // one deadline per fill: the lock waits of all stripes share the timeout
+    const auto deadline = std::chrono::steady_clock::now() + timeout.value_or(std::chrono::nanoseconds::zero());
+
+    std::atomic<std::size_t> skipped {0};
+    pool.run([&](std::size_t thread) {
+        const auto [begin, end] = chunk(data, size, thread, threads, granularity);
+        if (end <= begin) return;
+
+        const auto [first, count] = locks.stripes_of(begin, end - begin);
+        for (auto stripe = first; stripe < first + count; ++stripe) {
+            std::optional<std::chrono::nanoseconds> remaining;
+            if (timeout) {
+                const auto now = std::chrono::steady_clock::now();
+                remaining      = now < deadline ? deadline - now : std::chrono::nanoseconds::zero();
+            }
+
+            if (!locks.lock(stripe, remaining)) {
+                skipped.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+
+            const auto offset = std::max(begin, stripe * locks.get_stripe_size());
+            const auto length = std::min(end, (stripe + 1) * locks.get_stripe_size()) - offset;
+            fill_part(thread, bytes, {offset, length}, mask, stream, 0);
+            if (stream) stream_fence();
+            locks.unlock(stripe);
+        }
+    });
+
+    return skipped;
+}
+
+void ParallelFill::copy(void *dst, const void *src, std::size_t size) {
+    const auto threads = engines.size();
+    auto      *out     = static_cast<std::uint8_t *>(dst);
+    const auto in      = static_cast<const std::uint8_t *>(src);
+    const bool stream  = use_stream(size);
+    const bool bind    = numa_first_use(dst, size);
+
+    pool.run([&](std::size_t thread) {
+        const auto [begin, end] = chunk(dst, size, thread, threads);
+        if (end <= begin) return;
+
+        if (bind) numa_bind(out + begin, end - begin);
+
+        if (stream) {
+            stream_copy(out + begin, in + begin, end - begin);
+            stream_fence();
+        } else {
+            std::memcpy(out + begin, in + begin, end - begin);
+        }
+    });
+
+    numa_report();
+}
+
+ParallelFill::store_t parse_store(const std::string &name) {
+    if (name == "auto") return ParallelFill::store_t::AUTO;
+    if (name == "cached") return ParallelFill::store_t::CACHED;
+    if (name == "stream") return ParallelFill::store_t::STREAM;
+    throw std::invalid_argument("invalid store type '" + name + '\'');
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "distribution.hpp"
+#include "engine.hpp"
+#include "fill.hpp"
+#include "stripe_lock.hpp"
+#include "worker_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief fill a memory area with random data using multiple threads
+ * @details The memory area is split into one cache line aligned chunk per thread.
+ *          Every thread uses its own, independently seeded random engine.
+ *          The threads are created once (see WorkerPool) and always work on the same chunk.
+ *
+ *          In reproducible mode (see set_seed), the memory area is split into blocks of STREAM_BLOCK_SIZE bytes.
+ *          The engine is reseeded at the start of every block with a seed that is derived from the seed, the
+ *          generation, the stream and the offset of the block (see derive_seed). The result depends only on these
+ *          values, but not on the number of threads.
+ */
+class ParallelFill {
+public:
+    //* chunk boundaries are aligned to this size
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    //* byte range (offset, length)
+    using range_t = std::pair<std::size_t, std::size_t>;
+
+    //* store type used to write the memory area
+    enum class store_t {
+        AUTO,    //*< streaming stores if the memory area is at least as large as the threshold
+        CACHED,  //*< normal stores
+        STREAM,  //*< non-temporal (streaming) stores
+    };
+
+    //* size of the blocks with individual random streams in reproducible mode
+    static constexpr std::size_t STREAM_BLOCK_SIZE = 64 * 1024;
+
+    //* default streaming threshold if the size of the last level cache is unknown
+    static constexpr std::size_t DEFAULT_STREAM_THRESHOLD = 32 * 1024 * 1024;
+
+private:
+    std::vector<std::unique_ptr<RandomEngine>>        engines;
+    FillKernels                                       kernels;
+    WorkerPool                                        pool;
+    bool                                              numa;
+    std::vector<std::pair<const void *, std::size_t>> numa_areas;
+    std::atomic<bool>                                 numa_failed {false};
+    store_t                                           store = store_t::AUTO;
+    std::size_t                                       stream_threshold;
+    std::shared_ptr<const Distribution>               distribution;
+    std::optional<std::uint64_t>                      seed;
+    std::uint64_t                                     generation = 0;
+    std::vector<range_t>                              parts;
+
+    /**
+     * \brief check if streaming stores are used for a memory area
+     * @param size size of the memory area in bytes
+     * @return true if streaming stores are used
+     */
+    [[nodiscard]] bool use_stream(std::size_t size) const noexcept {
+        return store == store_t::STREAM || (store == store_t::AUTO && size >= stream_threshold);
+    }
+
+    /**
+     * \brief fill a part of a memory area (called by the worker threads)
+     * @param thread thread index
+     * @param data pointer to memory area
+     * @param part byte range (relative to data)
+     * @param mask bitmask that is applied to the generated random values (refers to data)
+     * @param stream_store use streaming stores
+     * @param stream_id stream (reproducible mode)
+     */
+    void fill_part(std::size_t     thread,
+                   std::uint8_t   *data,
+                   range_t         part,
+                   const LaneMask &mask,
+                   bool            stream_store,
+                   std::uint64_t   stream_id);
+
+    /**
+     * \brief check if the chunks of a memory area have to be moved to the NUMA nodes of the threads
+     * @details Only the first write of every memory area moves the chunks (if NUMA placement is enabled).
+     * @param data pointer to memory area
+     * @param size size of the memory area in bytes
+     * @return true if the chunks have to be moved
+     */
+    bool numa_first_use(const void *data, std::size_t size);
+
+    /**
+     * \brief move a chunk to the NUMA node of the calling thread (called by the worker threads)
+     * @param data pointer to the chunk
+     * @param size size of the chunk in bytes
+     */
+    void numa_bind(std::uint8_t *data, std::size_t size) noexcept;
+
+    /**
+     * \brief print a warning if a chunk could not be moved by numa_bind()
+     */
+    void numa_report() noexcept;
+
+public:
+    /**
+     * \brief create parallel fill
+     * @param engine_name name of the random engine (see make_engine)
+     * @param threads number of threads (>= 1)
+     * @param seed seed that is used to derive the seeds of all thread engines
+     * @param cpus cpus the threads are pinned to (see WorkerPool)
+     * @param numa move the chunk of every thread to the NUMA node of the thread
+     * @exception std::invalid_argument unknown engine name or threads == 0
+     * @exception std::system_error failed to pin threads
+     */
+    ParallelFill(const std::string      &engine_name,
+                 std::size_t             threads,
+                 std::uint64_t           seed,
+                 const std::vector<int> &cpus = {},
+                 bool                    numa = false);
+
+    /**
+     * \brief fill memory area with random data
+     * @details The calling thread is used as first worker.
+     * @param data pointer to memory area
+     * @param size size of the memory area in bytes
+     * @param mask bitmask that is applied to the generated random values
+     * @param stream_id random stream of the memory area (reproducible mode, e.g. region index)
+     */
+    void fill(void *data, std::size_t size, const LaneMask &mask, std::uint64_t stream_id = 0);
+
+    /**
+     * \brief fill parts of a memory area with random data
+     * @details If there are at least as many ranges as threads, every thread fills whole ranges.
+     *          Otherwise, every range is split into chunks like in fill().
+     *          No NUMA placement is done.
+     * @param data pointer to memory area
+     * @param ranges byte ranges (relative to data) that are filled
+     * @param mask bitmask that is applied to the generated random values (refers to data)
+     * @param stream_id random stream of the memory area (reproducible mode, e.g. region index)
+     */
+    void fill_ranges(void                       *data,
+                     const std::vector<range_t> &ranges,
+                     const LaneMask             &mask,
+                     std::uint64_t               stream_id = 0);
+
+    /**
+     * \brief fill memory area with random data stripe by stripe
+     * @details Every thread fills whole stripes. Each stripe is locked before and unlocked after it is written
+     *          (with a store fence in between if streaming stores are used). Stripes that can not be locked before
+     *          the timeout (measured from the start of the fill) expired are skipped.
+     *          No NUMA placement is done.
+     * @param data pointer to memory area (start of stripe 0)
+     * @param size size of the memory area in bytes
+     * @param mask bitmask that is applied to the generated random values
+     * @param locks lock table of the memory area
+     * @param timeout maximum wait for the locks of all stripes (std::nullopt: forever)
+     * @return number of skipped stripes
+     */
+    std::size_t fill_striped(void                                   *data,
+                             std::size_t                             size,
+                             const LaneMask                         &mask,
+                             StripeLocks                            &locks,
+                             std::optional<std::chrono::nanoseconds> timeout);
+
+    /**
+     * \brief copy data to a memory area
+     * @details The destination is split into the same chunks as for fill().
+     *          The chunks of the destination are moved to the NUMA nodes of the threads like in fill().
+     * @param dst destination
+     * @param src source
+     * @param size number of bytes
+     */
+    void copy(void *dst, const void *src, std::size_t size);
+
+    /**
+     * \brief set the store type
+     * @details With streaming stores, every thread issues a store fence after its chunk, so all data is globally
+     *          visible when fill(), fill_ranges() or copy() return.
+     * @param type store type
+     * @param threshold minimum size (in bytes) of a memory area for streaming stores in AUTO mode
+     *                  (0: size of the last level cache)
+     */
+    void set_store(store_t type, std::size_t threshold = 0) noexcept;
+
+    /**
+     * \brief set the distribution of the generated elements
+     * @details If a distribution is set, the mask of fill() and fill_ranges() is ignored and the chunks of the threads
+     *          are split at element boundaries (relative to the start of the memory area).
+     * @param dist distribution (nullptr: uniformly distributed random bits)
+     */
+    void set_distribution(std::shared_ptr<const Distribution> dist) noexcept { distribution = std::move(dist); }
+
+    /**
+     * \brief enable the reproducible mode
+     * @details All following fills produce the same data for the same seed, generation and stream,
+     *          regardless of the number of threads.
+     * @param base_seed seed of all random streams
+     */
+    void set_seed(std::uint64_t base_seed) noexcept { seed = base_seed; }
+
+    /**
+     * \brief set the generation of the following fills (reproducible mode)
+     * @param value generation (e.g. number of the fill)
+     */
+    void set_generation(std::uint64_t value) noexcept { generation = value; }
+
+    /**
+     * \brief get the streaming threshold
+     * @return minimum size (in bytes) of a memory area for streaming stores in AUTO mode
+     */
+    [[nodiscard]] std::size_t get_stream_threshold() const noexcept { return stream_threshold; }
+
+    /**
+     * \brief get the store type
+     * @return store type (see set_store)
+     */
+    [[nodiscard]] store_t get_store() const noexcept { return store; }
+
+    /**
+     * \brief get the number of threads
+     * @return number of threads
+     */
+    [[nodiscard]] std::size_t get_threads() const noexcept { return engines.size(); }
+
+    /**
+     * \brief get the random engine of a thread
+     * @param thread thread index
+     * @return random engine
+     */
+    [[nodiscard]] RandomEngine &get_engine(std::size_t thread = 0) { return *engines.at(thread); }
+
+    /**
+     * \brief get the byte range of a thread
+     * @param data pointer to memory area
+     * @param size size of the memory area in bytes
+     * @param thread thread index
+     * @param threads number of threads
+     * @param granularity chunk boundaries are multiples of this size (relative to data)
+     * @return begin and end offset (relative to data)
+     */
+    static std::pair<std::size_t, std::size_t> chunk(const void *data,
+                                                     std::size_t size,
+                                                     std::size_t thread,
+                                                     std::size_t threads,
+                                                     std::size_t granularity = 1) noexcept;
+};
+
+/**
+ * \brief parse a store type
+ * @param name store type (auto, cached or stream)
+ * @return store type
+ * @exception std::invalid_argument unknown store type
+ */
+ParallelFill::store_t parse_store(const std::string &name);
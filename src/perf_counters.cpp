@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "perf_counters.hpp"
+
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+
+/**
+ * \brief id of a generalized cache event
+ */
+static constexpr std::uint64_t cache_event(std::uint64_t cache, std::uint64_t op, std::uint64_t result) {
+    return cache | (op << 8U) | (result << 16U);  // NOLINT
+}
+
+/**
+ * \brief open a counter for the calling thread and all threads that are created afterwards
+ * @return file descriptor (-1: not available)
+ */
+static int open_counter(std::uint32_t type, std::uint64_t config) noexcept {
+    perf_event_attr attr {};
+    attr.size           = sizeof(attr);
+    attr.type           = type;
+    attr.config         = config;
+    attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.inherit        = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+PerfCounters::PerfCounters() {
+    struct Definition {
+        event_t       event;
+        std::uint32_t type;
+        std::uint64_t config;
+    };
+
+    static constexpr auto DTLB_LOAD_MISSES =
+            cache_event(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS);
+    static constexpr auto DTLB_STORE_MISSES =
+            cache_event(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_WRITE, PERF_COUNT_HW_CACHE_RESULT_MISS);
+
+    // the dTLB misses are the sum of the load and the store misses (if both are supported)
+    static constexpr std::array<Definition, 6> DEFINITIONS {
+            Definition {CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            Definition {INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            Definition {LLC_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            Definition {DTLB_MISSES, PERF_TYPE_HW_CACHE, DTLB_LOAD_MISSES},
+            Definition {DTLB_MISSES, PERF_TYPE_HW_CACHE, DTLB_STORE_MISSES},
+            Definition {PAGE_FAULTS, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+    };
+
+    int error = 0;
+    for (const auto &definition : DEFINITIONS) {
+        const int fd = open_counter(definition.type, definition.config);
+        if (fd == -1) {
+            error = errno;
+            continue;
+        }
+        counters.push_back({definition.event, fd});
+        mask |= std::uint64_t {1} << definition.event;
+    }
+
+    if (counters.empty()) throw std::system_error(error, std::generic_category(), "perf_event_open");
+}
+
+PerfCounters::~PerfCounters() {
+    for (const auto &counter : counters)
+        close(counter.fd);
+}
+
+PerfCounters::Sample PerfCounters::read() const noexcept {
+    Sample sample {};
+    for (const auto &counter : counters) {
+        // value, time enabled, time running
+        std::array<std::uint64_t, 3> values {};
+        if (::read(counter.fd, values.data(), sizeof(values)) != sizeof(values)) continue;
+
+        auto value = values[0];
+        if (values[2] != 0 && values[2] < values[1]) {
+            // multiplexed counter: scale to the enabled time
+            value = static_cast<std::uint64_t>(static_cast<double>(value) * static_cast<double>(values[1]) /
+                                               static_cast<double>(values[2]));
+        }
+        sample[counter.event] += value;
+    }
+    return sample;
+}
+
+const char *PerfCounters::event_name(std::size_t event) noexcept {
+    static constexpr std::array<const char *, EVENTS> NAMES {
+            "cycles", "instructions", "llc_misses", "dtlb_misses", "page_faults"};
+    return event < EVENTS ? NAMES[event] : "unknown";
+}
+
+PerfCounters::Sample PerfCounters::diff(const Sample &end, const Sample &begin) noexcept {
+    Sample result {};
+    for (std::size_t i = 0; i < EVENTS; ++i)
+        result[i] = end[i] >= begin[i] ? end[i] - begin[i] : 0;
+    return result;
+}
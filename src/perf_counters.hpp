@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \brief hardware and software performance counters of the process (perf_event_open)
+ * @details The counters are opened for the calling thread and inherited by all threads that are created afterwards
+ *          (e.g. the worker threads of ParallelFill). read() returns the sum of all these threads.
+ *          Only user space is counted, this is permitted with the default perf_event_paranoid setting of 2.
+ *
+ *          Counters that are not supported by the CPU (or the hypervisor) are not available and read as 0.
+ *          If the kernel multiplexes the counters, the values are scaled to the enabled time.
+ */
+class PerfCounters {
+public:
+    //* counted events
+    enum event_t : std::size_t { CYCLES, INSTRUCTIONS, LLC_MISSES, DTLB_MISSES, PAGE_FAULTS };
+
+    //* number of events
+    static constexpr std::size_t EVENTS = 5;
+
+    //* counter values (index: event_t)
+    using Sample = std::array<std::uint64_t, EVENTS>;
+
+private:
+    struct Counter {
+        event_t event;
+        int     fd;
+    };
+
+    std::vector<Counter> counters;
+    std::uint64_t        mask = 0;
+
+public:
+    /**
+     * \brief open the counters
+     * @exception std::system_error none of the counters could be opened (e.g. perf_event_paranoid > 2)
+     */
+    PerfCounters();
+
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters &)            = delete;
+    PerfCounters(PerfCounters &&)                 = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+    PerfCounters &operator=(PerfCounters &&)      = delete;
+
+    /**
+     * \brief read the counters
+     * @details One read() system call per counter.
+     * @return current values (accumulated since the construction)
+     */
+    [[nodiscard]] Sample read() const noexcept;
+
+    /**
+     * \brief get the available events
+     * @return bit mask of the available events (bit i: event_t i)
+     */
+    [[nodiscard]] std::uint64_t get_available() const noexcept { return mask; }
+
+    /**
+     * \brief get the name of an event
+     * @param event event
+     * @return name (e.g. "cycles")
+     */
+    static const char *event_name(std::size_t event) noexcept;
+
+    /**
+     * \brief get the difference of two samples
+     * @param end later sample
+     * @param begin earlier sample
+     * @return end - begin
+     */
+    static Sample diff(const Sample &end, const Sample &begin) noexcept;
+};
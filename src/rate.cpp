@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "rate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+//* maximum content of the token bucket in ticks
+static constexpr double BURST_TICKS = 2;
+
+RatePacer::RatePacer(std::size_t size, double rate, std::chrono::nanoseconds tick, std::size_t granularity)
+    : size(size), granularity(granularity), rate(rate) {
+    if (granularity == 0 || size < granularity) throw std::invalid_argument("size must not be 0");
+    if (!(rate > 0) || !std::isfinite(rate)) throw std::invalid_argument("the rate must be greater than 0");
+    if (tick.count() <= 0) throw std::invalid_argument("a rate requires an interval greater than 0");
+
+    const auto per_tick = rate * std::chrono::duration<double>(tick).count();
+    burst               = std::max(per_tick * BURST_TICKS, static_cast<double>(granularity));
+}
+
+bool RatePacer::refill() {
+    const auto now = clock::now();
+    if (start == clock::time_point()) {
+        start = now;
+        last  = now;
+    }
+
+    tokens = std::min(burst, tokens + rate * std::chrono::duration<double>(now - last).count());
+    last   = now;
+    return tokens >= static_cast<double>(granularity);
+}
+
+std::size_t RatePacer::next() {
+    auto chunk = static_cast<std::size_t>(tokens) / granularity * granularity;
+    chunk      = std::min(chunk, size / granularity * granularity);
+    tokens -= static_cast<double>(chunk);
+
+    ranges.clear();
+    update_size = chunk;
+    if (chunk == 0) return 0;
+
+    // wrap around at the end of the memory area (incomplete last element is never written)
+    const auto end   = size / granularity * granularity;
+    const auto first = std::min(chunk, end - cursor);
+    ranges.emplace_back(cursor, first);
+    if (first < chunk) ranges.emplace_back(0, chunk - first);
+    cursor = (cursor + chunk) % end;
+
+    return chunk;
+}
+
+void RatePacer::write(void *data, const LaneMask &mask, ParallelFill &filler) {
+    if (ranges.empty()) return;
+    filler.fill_ranges(data, ranges, mask);
+    written += update_size;
+}
+
+double RatePacer::get_achieved_rate() const noexcept {
+    if (start == clock::time_point()) return 0;
+    const auto elapsed = std::chrono::duration<double>(clock::now() - start).count();
+    return elapsed > 0 ? static_cast<double>(written) / elapsed : 0;
+}
+
+double parse_rate(const std::string &str) {
+    std::size_t idx = 0;
+    double      value;
+    try {
+        value = std::stod(str, &idx);
+    } catch (const std::exception &) { throw std::invalid_argument("invalid rate '" + str + '\''); }
+
+    auto unit = str.substr(idx);
+    if (unit.size() >= 2 && unit.compare(unit.size() - 2, 2, "/s") == 0) unit.resize(unit.size() - 2);
+
+    static constexpr double KILO = 1000;
+    static constexpr double KIBI = 1024;
+
+    double factor;
+    if (unit.empty() || unit == "B") factor = 1;
+    else if (unit == "kB" || unit == "KB") factor = KILO;
+    else if (unit == "MB") factor = KILO * KILO;
+    else if (unit == "GB") factor = KILO * KILO * KILO;
+    else if (unit == "TB") factor = KILO * KILO * KILO * KILO;
+    else if (unit == "KiB") factor = KIBI;
+    else if (unit == "MiB") factor = KIBI * KIBI;
+    else if (unit == "GiB") factor = KIBI * KIBI * KIBI;
+    else if (unit == "TiB") factor = KIBI * KIBI * KIBI * KIBI;
+    else throw std::invalid_argument("invalid rate '" + str + '\'');
+
+    const auto rate = value * factor;
+    if (!std::isfinite(rate) || rate <= 0) throw std::invalid_argument("invalid rate '" + str + '\'');
+    return rate;
+}
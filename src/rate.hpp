@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "fill.hpp"
+#include "parallel_fill.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * \brief write a memory area with a target rate (bytes per second)
+ * @details A token bucket is refilled with the target rate. Every tick, the available tokens (whole elements) are
+ *          spent on the next chunk of the memory area. The chunks follow each other and wrap around at the end of
+ *          the memory area.
+ *
+ *          The bucket holds at most the tokens of two ticks (a late tick is caught up) and one chunk is at most
+ *          the size of the memory area. Tokens above these limits are discarded, so the achieved rate falls behind
+ *          the target rate if the writes are too slow.
+ */
+class RatePacer {
+private:
+    using clock = std::chrono::steady_clock;
+
+    std::size_t                        size;
+    std::size_t                        granularity;
+    double                             rate;
+    double                             burst;
+    double                             tokens = 0;
+    std::size_t                        cursor = 0;
+    std::vector<ParallelFill::range_t> ranges;
+    std::size_t                        update_size = 0;
+    std::uint64_t                      written     = 0;
+    clock::time_point                  start;
+    clock::time_point                  last;
+
+public:
+    /**
+     * \brief create rate pacer
+     * @param size size of the memory area in bytes
+     * @param rate target rate in bytes per second (> 0)
+     * @param tick tick period of the scheduler (> 0)
+     * @param granularity chunks are multiples of this size (element size)
+     * @exception std::invalid_argument invalid rate, tick or size == 0
+     */
+    RatePacer(std::size_t size, double rate, std::chrono::nanoseconds tick, std::size_t granularity);
+
+    /**
+     * \brief refill the token bucket
+     * @return true if the tokens are sufficient for at least one element
+     */
+    bool refill();
+
+    /**
+     * \brief spend the tokens on the next chunk
+     * @details Consumes the tokens and advances the cursor. Call it only if the chunk is written afterwards.
+     * @return size of the chunk in bytes (0: nothing to write in this tick)
+     */
+    std::size_t next();
+
+    /**
+     * \brief write the chunk that was selected by next()
+     * @param data pointer to memory area
+     * @param mask bitmask that is applied to the generated random values
+     * @param filler (multi threaded) random data generator
+     */
+    void write(void *data, const LaneMask &mask, ParallelFill &filler);
+
+    /**
+     * \brief get the number of bytes that are written by write()
+     * @return number of bytes
+     */
+    [[nodiscard]] std::size_t get_update_size() const noexcept { return update_size; }
+
+    /**
+     * \brief get the target rate
+     * @return bytes per second
+     */
+    [[nodiscard]] double get_target_rate() const noexcept { return rate; }
+
+    /**
+     * \brief get the achieved rate since the first call of refill()
+     * @return bytes per second
+     */
+    [[nodiscard]] double get_achieved_rate() const noexcept;
+};
+
+/**
+ * \brief parse a data rate
+ * @details Format: number with optional unit B, kB, MB, GB, TB (powers of 1000) or KiB, MiB, GiB, TiB (powers of
+ *          1024), optionally followed by /s, e.g. 2GiB/s. A number without unit is in bytes per second.
+ * @param str data rate
+ * @return bytes per second
+ * @exception std::invalid_argument invalid data rate
+ */
+double parse_rate(const std::string &str);
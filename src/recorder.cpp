@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "recorder.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <system_error>
+#include <unistd.h>
+
+/**
+ * \brief round the ring buffer size up to whole chunks
+ */
+static std::size_t ring_capacity(std::size_t buffer_size) {
+    const auto chunks = (buffer_size + Recorder::CHUNK_SIZE - 1) / Recorder::CHUNK_SIZE;
+    return std::max<std::size_t>(chunks, 2) * Recorder::CHUNK_SIZE;
+}
+
+Recorder::Recorder(const std::string &path, std::size_t buffer_size)
+    : capacity(ring_capacity(buffer_size)), ring(capacity) {
+    static constexpr mode_t MODE = 0644;
+
+    fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | O_DIRECT, MODE);
+    if (fd == -1 && errno == EINVAL) {
+        // file system without O_DIRECT support (e.g. tmpfs)
+        direct = false;
+        fd     = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, MODE);
+    }
+    if (fd == -1) throw std::system_error(errno, std::generic_category(), "failed to create '" + path + '\'');
+
+    try {
+        writer = std::thread(&Recorder::write_loop, this);
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+}
+
+Recorder::~Recorder() {
+    finish();
+    close(fd);
+}
+
+bool Recorder::write_at(std::uint64_t offset, std::size_t size) {
+    const auto *src = ring.get_addr() + offset % capacity;
+    std::size_t pos = 0;
+    while (pos < size) {
+        const auto count = pwrite(fd, src + pos, size - pos, static_cast<off_t>(offset + pos));
+        if (count == -1) {
+            if (errno == EINTR) continue;
+            error = errno;
+            return false;
+        }
+        pos += static_cast<std::size_t>(count);
+    }
+    return true;
+}
+
+void Recorder::write_loop() {
+    while (true) {
+        const auto w = wake.load(std::memory_order_acquire);
+
+        // copy before writing: the recording thread waits for the copy (also after a write error)
+        if (const auto *data = pending.load(std::memory_order_acquire)) {
+            copy(data, pending_size);
+            pending.store(nullptr, std::memory_order_release);
+            pending.notify_one();
+            continue;
+        }
+
+        const auto h = head.load(std::memory_order_acquire);
+        const auto t = tail.load(std::memory_order_relaxed);
+        if (!error.load(std::memory_order_relaxed) && h - t >= CHUNK_SIZE) {
+            if (write_at(t, CHUNK_SIZE)) tail.store(t + CHUNK_SIZE, std::memory_order_release);
+            continue;
+        }
+
+        if (stop.load(std::memory_order_acquire)) break;
+        wake.wait(w, std::memory_order_acquire);
+    }
+    if (error.load(std::memory_order_relaxed)) return;
+
+    // last partial chunk: O_DIRECT requires aligned sizes
+    const auto h = head.load(std::memory_order_acquire);
+    const auto t = tail.load(std::memory_order_relaxed);
+    if (h == t) return;
+    if (direct) {
+        const int flags = fcntl(fd, F_GETFL);
+        if (flags == -1 || fcntl(fd, F_SETFL, flags & ~O_DIRECT) == -1) {
+            error = errno;
+            return;
+        }
+    }
+    if (write_at(t, h - t)) tail.store(h, std::memory_order_release);
+}
+
+void Recorder::copy(const void *data, std::size_t size) noexcept {
+    const auto h = head.load(std::memory_order_relaxed);
+
+    // copy (with wrap around at the end of the ring buffer)
+    const auto *src   = static_cast<const std::uint8_t *>(data);
+    const auto  pos   = h % capacity;
+    const auto  first = std::min(size, capacity - pos);
+    std::memcpy(ring.get_addr() + pos, src, first);
+    std::memcpy(ring.get_addr(), src + first, size - first);
+    head.store(h + size, std::memory_order_release);
+}
+
+bool Recorder::record(const void *data, std::size_t size) noexcept {
+    wait();
+    const auto h = head.load(std::memory_order_relaxed);
+    if (stop.load(std::memory_order_relaxed) || error.load(std::memory_order_relaxed) ||
+        capacity - (h - tail.load(std::memory_order_acquire)) < size) {
+        ++dropped;
+        return false;
+    }
+
+    copy(data, size);
+
+    // wake the writer only if a chunk was completed
+    if (h / CHUNK_SIZE != (h + size) / CHUNK_SIZE) {
+        wake.fetch_add(1, std::memory_order_release);
+        wake.notify_one();
+    }
+    return true;
+}
+
+bool Recorder::record_async(const void *data, std::size_t size) noexcept {
+    wait();
+    const auto h = head.load(std::memory_order_relaxed);
+    if (stop.load(std::memory_order_relaxed) || error.load(std::memory_order_relaxed) ||
+        capacity - (h - tail.load(std::memory_order_acquire)) < size) {
+        ++dropped;
+        return false;
+    }
+
+    pending_size = size;
+    pending.store(data, std::memory_order_release);
+    wake.fetch_add(1, std::memory_order_release);
+    wake.notify_one();
+    return true;
+}
+
+void Recorder::wait() const noexcept {
+    const void *data = nullptr;
+    while ((data = pending.load(std::memory_order_acquire)))
+        pending.wait(data, std::memory_order_acquire);
+}
+
+void Recorder::finish() noexcept {
+    if (!writer.joinable()) return;
+
+    wait();
+    stop.store(true, std::memory_order_release);
+    wake.fetch_add(1, std::memory_order_release);
+    wake.notify_one();
+    writer.join();
+    if (!error && fdatasync(fd) == -1) error = errno;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "buffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+/**
+ * \brief append only log that is written to a file by a writer thread
+ * @details The recorded data is copied into a ring buffer. The writer thread writes the ring buffer in chunks of
+ *          CHUNK_SIZE bytes with O_DIRECT (if supported by the file system), so neither the page cache nor the
+ *          write latency of the file affect the recording thread. The last partial chunk is written by finish().
+ *          Large records (frames) are handed over with record_async(), which leaves the copy to the writer thread.
+ *
+ *          If the ring buffer is full (the file is slower than the recording), the data of record() is dropped as a
+ *          whole.
+ */
+class Recorder {
+public:
+    //* size of the writes to the file (multiple of the O_DIRECT alignment of all common file systems)
+    static constexpr std::size_t CHUNK_SIZE = 1024 * 1024;
+
+private:
+    int                        fd;
+    bool                       direct = true;
+    std::size_t                capacity;
+    PrivateBuffer              ring;
+    std::atomic<std::uint64_t> head {0};
+    std::atomic<std::uint64_t> tail {0};
+    std::atomic<const void *>  pending {nullptr};  //*< data of record_async() that is not copied yet
+    std::size_t                pending_size = 0;
+    std::atomic<std::uint32_t> wake {0};
+    std::atomic<bool>          stop {false};
+    std::atomic<int>           error {0};
+    std::uint64_t              dropped = 0;
+    std::thread                writer;
+
+    void write_loop();
+
+    /**
+     * \brief copy data to the head of the ring buffer
+     */
+    void copy(const void *data, std::size_t size) noexcept;
+
+    /**
+     * \brief write a contiguous part of the ring buffer to the file
+     * @return false on error
+     */
+    bool write_at(std::uint64_t offset, std::size_t size);
+
+public:
+    /**
+     * \brief create the log file and start the writer thread
+     * @details An existing file is truncated.
+     * @param path path of the file
+     * @param buffer_size size of the ring buffer in bytes (rounded up to 2 * CHUNK_SIZE at least)
+     * @exception std::system_error failed to create the file or to allocate the ring buffer
+     */
+    Recorder(const std::string &path, std::size_t buffer_size);
+
+    ~Recorder();
+
+    Recorder(const Recorder &)            = delete;
+    Recorder(Recorder &&)                 = delete;
+    Recorder &operator=(const Recorder &) = delete;
+    Recorder &operator=(Recorder &&)      = delete;
+
+    /**
+     * \brief append data to the log
+     * @param data data
+     * @param size size in bytes
+     * @return false if the data was dropped (ring buffer full or write error)
+     */
+    bool record(const void *data, std::size_t size) noexcept;
+
+    /**
+     * \brief append data to the log, the data is copied by the writer thread
+     * @details The data must not be modified until wait() returned.
+     *          Waits for the previous record_async() call.
+     * @param data data
+     * @param size size in bytes
+     * @return false if the data was dropped (ring buffer full or write error)
+     */
+    bool record_async(const void *data, std::size_t size) noexcept;
+
+    /**
+     * \brief wait until the data of the last record_async() call was copied
+     */
+    void wait() const noexcept;
+
+    /**
+     * \brief write all recorded data to the file and stop the writer thread
+     * @details Called by the destructor if not called before. No data can be recorded afterwards.
+     */
+    void finish() noexcept;
+
+    /**
+     * \brief check if the file is written with O_DIRECT
+     * @return false if the file system does not support O_DIRECT
+     */
+    [[nodiscard]] bool is_direct() const noexcept { return direct; }
+
+    /**
+     * \brief get the number of dropped records
+     * @return number of calls of record() that returned false
+     */
+    [[nodiscard]] std::uint64_t get_dropped() const noexcept { return dropped; }
+
+    /**
+     * \brief get the error of the writer thread
+     * @return errno of the failed write (0: no error)
+     */
+    [[nodiscard]] int get_error() const noexcept { return error.load(std::memory_order_relaxed); }
+};
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "region.hpp"
+
+#include "scheduler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+
+/**
+ * \brief parse an unsigned integer (whole string)
+ */
+static std::uint64_t parse_uint(const std::string &str, int base, const std::string &spec) {
+    std::size_t   idx = 0;
+    std::uint64_t value;
+    try {
+        value = std::stoull(str, &idx, base);
+    } catch (const std::exception &) { throw std::invalid_argument("invalid region '" + spec + '\''); }
+    if (idx != str.size() || str.front() == '-') throw std::invalid_argument("invalid region '" + spec + '\'');
+    return value;
+}
+
+RegionSpec parse_region(const std::string &spec) {
+    RegionSpec region;
+
+    std::size_t pos = 0;
+    while (pos < spec.size()) {
+        const auto end   = std::min(spec.find(',', pos), spec.size());
+        const auto item  = spec.substr(pos, end - pos);
+        const auto equal = item.find('=');
+        if (equal == std::string::npos || equal + 1 == item.size())
+            throw std::invalid_argument("invalid region '" + spec + '\'');
+
+        const auto key   = item.substr(0, equal);
+        const auto value = item.substr(equal + 1);
+
+        if (key == "offset") {
+            region.offset = parse_uint(value, 0, spec);
+        } else if (key == "elements") {
+            region.elements = parse_uint(value, 0, spec);
+        } else if (key == "alignment") {
+            region.alignment = parse_uint(value, 10, spec);  // NOLINT
+            if (region.alignment != 1 && region.alignment != 2 && region.alignment != 4 && region.alignment != 8)
+                throw std::invalid_argument("invalid alignment in region '" + spec + '\'');
+        } else if (key == "mask") {
+            region.mask = parse_uint(value, 16, spec);  // NOLINT
+        } else if (key == "interval") {
+            region.interval = parse_duration(value);
+            if (region.interval->count() == 0)
+                throw std::invalid_argument("invalid interval in region '" + spec + '\'');
+        } else {
+            throw std::invalid_argument("unknown key '" + key + "' in region '" + spec + '\'');
+        }
+
+        pos = end + 1;
+    }
+
+    return region;
+}
+
+std::vector<RegionSpec> read_region_file(const std::string &path) {
+    std::ifstream file(path);
+    if (!file) throw std::runtime_error("failed to open region file '" + path + '\'');
+
+    std::vector<RegionSpec> regions;
+    std::string             line;
+    while (std::getline(file, line)) {
+        const auto first = line.find_first_not_of(" \t");
+        if (first == std::string::npos || line[first] == '#') continue;
+        const auto last = line.find_last_not_of(" \t\r");
+        regions.push_back(parse_region(line.substr(first, last - first + 1)));
+    }
+
+    if (file.bad()) throw std::runtime_error("failed to read region file '" + path + '\'');
+
+    return regions;
+}
+
+RegionSet::RegionSet(const std::vector<RegionSpec> &specs,
+                     std::size_t                    memory_size,
+                     std::chrono::nanoseconds       default_interval)
+    : period(0) {
+    if (specs.empty()) throw std::invalid_argument("no regions");
+
+    std::vector<std::chrono::nanoseconds> intervals;
+    intervals.reserve(specs.size());
+    for (const auto &spec : specs) {
+        if (spec.offset >= memory_size)
+            throw std::invalid_argument("region at offset " + std::to_string(spec.offset) +
+                                        " is outside of the shared memory");
+
+        const auto available = (memory_size - spec.offset) / spec.alignment;
+        const auto elements  = spec.elements.value_or(available);
+        if (elements == 0 || elements > available)
+            throw std::invalid_argument("region at offset " + std::to_string(spec.offset) +
+                                        " does not fit into the shared memory");
+
+        regions.push_back({spec.offset, elements * spec.alignment, LaneMask(spec.mask, spec.alignment), 1, true});
+        intervals.push_back(spec.interval.value_or(default_interval));
+    }
+
+    period = common_period(intervals);
+    if (period.count() == 0) return;
+
+    for (std::size_t i = 0; i < regions.size(); ++i) {
+        if (intervals[i].count() == 0)
+            throw std::invalid_argument("region intervals can not be combined with an interval of 0");
+        regions[i].divider = static_cast<std::uint64_t>(intervals[i] / period);
+    }
+}
+
+std::chrono::nanoseconds RegionSet::common_period(const std::vector<std::chrono::nanoseconds> &intervals) {
+    std::chrono::nanoseconds period(0);
+    for (const auto interval : intervals)
+        period = std::chrono::nanoseconds(std::gcd(period.count(), interval.count()));
+
+    // a single interval is used as it is (same as without regions)
+    const bool different = std::adjacent_find(intervals.begin(), intervals.end(), std::not_equal_to<>()) !=
+                           intervals.end();
+    if (different && period.count() != 0 && period < MIN_PERIOD) {
+        throw std::invalid_argument("the greatest common divisor of the intervals (" + std::to_string(period.count()) +
+                                    " ns) is less than the minimum tick period of " +
+                                    std::to_string(MIN_PERIOD.count() / 1000) + " us");  // NOLINT
+    }
+    return period;
+}
+
+bool RegionSet::advance() noexcept {
+    bool any = false;
+    for (auto &region : regions) {
+        region.due = tick % region.divider == 0;
+        any        = any || region.due;
+    }
+    ++tick;
+    return any;
+}
+
+std::size_t RegionSet::fill(void *data, ParallelFill &filler, std::uint64_t set_id) {
+    auto       *bytes   = static_cast<std::uint8_t *>(data);
+    std::size_t written = 0;
+    for (std::size_t i = 0; i < regions.size(); ++i) {
+        const auto &region = regions[i];
+        if (!region.due) continue;
+        filler.fill(bytes + region.offset, region.size, region.mask, (set_id << 32U) | i);  // NOLINT
+        written += region.size;
+    }
+    return written;
+}
+
+bool RegionSet::overlaps(std::size_t offset, std::size_t size) const noexcept {
+    for (const auto &region : regions) {
+        if (offset < region.offset + region.size && region.offset < offset + size) return true;
+    }
+    return false;
+}
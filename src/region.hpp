@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "fill.hpp"
+#include "parallel_fill.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+//* specification of a region of the shared memory
+struct RegionSpec {
+    //* offset in bytes
+    std::size_t offset = 0;
+
+    //* number of elements (default: up to the end of the memory area)
+    std::optional<std::size_t> elements;
+
+    //* element size (1, 2, 4 or 8)
+    std::size_t alignment = 1;
+
+    //* bitmask that is applied to the random values
+    std::uint64_t mask = ~static_cast<std::uint64_t>(0);
+
+    //* update interval (default: global interval)
+    std::optional<std::chrono::nanoseconds> interval;
+};
+
+/**
+ * \brief parse a region specification
+ * @details Format: comma separated key=value pairs. Keys: offset, elements, alignment, mask (hex), interval (see
+ *          parse_duration). All keys are optional. Example: offset=64,elements=16,alignment=4,mask=ff,interval=10ms
+ * @param spec region specification
+ * @return region
+ * @exception std::invalid_argument invalid specification
+ */
+RegionSpec parse_region(const std::string &spec);
+
+/**
+ * \brief read region specifications from a file
+ * @details One region specification per line (see parse_region). Empty lines and lines starting with # are ignored.
+ * @param path path of the file
+ * @return regions
+ * @exception std::runtime_error failed to read the file
+ * @exception std::invalid_argument invalid specification
+ */
+std::vector<RegionSpec> read_region_file(const std::string &path);
+
+/**
+ * \brief multiple regions of one memory area that are updated with individual intervals
+ * @details The tick period is the greatest common divisor of all region intervals (see common_period).
+ *          Every region is written every (interval / period) ticks.
+ *          All regions that are due in the same tick are written within one synchronization (coalesced locking).
+ */
+class RegionSet {
+public:
+    //* minimum tick period of different intervals (a smaller greatest common divisor would busy spin the timer)
+    static constexpr std::chrono::nanoseconds MIN_PERIOD = std::chrono::microseconds(10);  // NOLINT
+
+private:
+    struct Region {
+        std::size_t   offset;
+        std::size_t   size;
+        LaneMask      mask;
+        std::uint64_t divider;
+        bool          due;
+    };
+
+    std::vector<Region>      regions;
+    std::chrono::nanoseconds period;
+    std::uint64_t            tick = 0;
+
+public:
+    /**
+     * \brief create region set
+     * @param specs region specifications
+     * @param memory_size size of the memory area in bytes
+     * @param default_interval interval of regions without interval (0: regions are written every tick)
+     * @exception std::invalid_argument region outside of the memory area or invalid interval
+     */
+    RegionSet(const std::vector<RegionSpec> &specs, std::size_t memory_size, std::chrono::nanoseconds default_interval);
+
+    /**
+     * \brief get the tick period of multiple intervals
+     * @details The tick period is the greatest common divisor of the intervals.
+     *          If the intervals differ, it has to be at least MIN_PERIOD.
+     * @param intervals intervals
+     * @return tick period (0: all intervals are 0)
+     * @exception std::invalid_argument tick period below MIN_PERIOD
+     */
+    static std::chrono::nanoseconds common_period(const std::vector<std::chrono::nanoseconds> &intervals);
+
+    /**
+     * \brief get the tick period
+     * @return tick period (0: every region is written every tick)
+     */
+    [[nodiscard]] std::chrono::nanoseconds get_period() const noexcept { return period; }
+
+    /**
+     * \brief advance to the next tick
+     * @details The first tick writes all regions.
+     * @return true if at least one region is due
+     */
+    bool advance() noexcept;
+
+    /**
+     * \brief write all regions that are due in the current tick
+     * @param data pointer to memory area
+     * @param filler (multi threaded) random data generator
+     * @param set_id identifies the region set in reproducible mode (see ParallelFill::set_seed).
+     *               The random stream of every region is (set_id << 32) | region index.
+     * @return number of bytes written
+     */
+    std::size_t fill(void *data, ParallelFill &filler, std::uint64_t set_id = 0);
+
+    /**
+     * \brief check if a byte range overlaps with any region
+     * @param offset offset of the byte range
+     * @param size size of the byte range
+     * @return true if the byte range overlaps
+     */
+    [[nodiscard]] bool overlaps(std::size_t offset, std::size_t size) const noexcept;
+
+    /**
+     * \brief get the number of regions
+     * @return number of regions
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return regions.size(); }
+};
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "replay.hpp"
+
+#include <array>
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+MappedReplay::MappedReplay(int fd, std::size_t frame_size, bool loop) : ReplaySource(frame_size), loop(loop) {
+    struct stat st {};
+    if (fstat(fd, &st) == -1) {
+        const int tmp = errno;
+        close(fd);
+        throw std::system_error(tmp, std::generic_category(), "fstat");
+    }
+
+    map_size = static_cast<std::size_t>(st.st_size);
+    frames   = map_size / frame_size;
+    if (frames == 0) {
+        close(fd);
+        throw std::runtime_error("the replay file does not contain a complete frame of " +
+                                 std::to_string(frame_size) + " bytes");
+    }
+
+    // the mapping keeps the file referenced
+    void     *tmp       = mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd, 0);
+    const int map_error = errno;
+    close(fd);
+    if (tmp == MAP_FAILED) throw std::system_error(map_error, std::generic_category(), "failed to map replay file");
+    addr = static_cast<const std::uint8_t *>(tmp);
+
+    madvise(tmp, map_size, MADV_SEQUENTIAL);
+}
+
+MappedReplay::~MappedReplay() {
+    munmap(const_cast<std::uint8_t *>(addr), map_size);  // NOLINT
+}
+
+const void *MappedReplay::acquire() {
+    if (index == frames) {
+        if (!loop) {
+            end = true;
+            return nullptr;
+        }
+        index = 0;
+    }
+
+    // read ahead: request the next frame while the current one is copied
+    const auto        next      = (index + 1) % frames * frame_size;
+    static const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const auto        page      = next / page_size * page_size;
+    madvise(const_cast<std::uint8_t *>(addr) + page, next + frame_size - page, MADV_WILLNEED);  // NOLINT
+
+    return addr + index * frame_size;
+}
+
+void MappedReplay::release() noexcept {
+    ++index;
+}
+
+/**
+ * \brief validate the number of ring buffer slots
+ */
+static std::size_t check_slots(std::size_t slots) {
+    if (slots == 0) throw std::invalid_argument("the replay buffer requires at least one frame");
+    return slots;
+}
+
+StreamReplay::StreamReplay(int fd, std::size_t frame_size, std::size_t slots)
+    : ReplaySource(frame_size), fd(fd), slots(check_slots(slots)), ring(slots * frame_size) {
+    event_fd = eventfd(0, EFD_CLOEXEC);
+    if (event_fd == -1) throw std::system_error(errno, std::generic_category(), "eventfd");
+
+    try {
+        reader = std::thread(&StreamReplay::read_loop, this);
+    } catch (...) {
+        close(event_fd);
+        throw;
+    }
+}
+
+StreamReplay::~StreamReplay() {
+    stop = true;
+
+    // wake the reader thread (waiting for a free slot or for input)
+    consumed.fetch_add(1);
+    consumed.notify_one();
+    const std::uint64_t         value = 1;
+    [[maybe_unused]] const auto tmp   = write(event_fd, &value, sizeof(value));
+
+    reader.join();
+    close(event_fd);
+    close(fd);
+}
+
+bool StreamReplay::read_frame(std::uint8_t *dst) {
+    std::array<pollfd, 2> fds {pollfd {fd, POLLIN, 0}, pollfd {event_fd, POLLIN, 0}};
+
+    std::size_t pos = 0;
+    while (pos < frame_size) {
+        if (poll(fds.data(), fds.size(), -1) == -1) {
+            if (errno == EINTR) continue;
+            error = errno;
+            return false;
+        }
+        if (fds[1].revents) return false;
+
+        const auto count = read(fd, dst + pos, frame_size - pos);
+        if (count == -1) {
+            if (errno == EINTR || errno == EAGAIN) continue;
+            error = errno;
+            return false;
+        }
+        if (count == 0) return false;
+        pos += static_cast<std::size_t>(count);
+    }
+    return true;
+}
+
+void StreamReplay::read_loop() {
+    while (!stop) {
+        const auto w = written.load(std::memory_order_relaxed);
+
+        // wait for a free slot
+        auto c = consumed.load(std::memory_order_acquire);
+        while (w - c >= slots) {
+            consumed.wait(c, std::memory_order_acquire);
+            if (stop) return;
+            c = consumed.load(std::memory_order_acquire);
+        }
+
+        if (!read_frame(ring.get_addr() + w % slots * frame_size)) break;
+        written.store(w + 1, std::memory_order_release);
+    }
+
+    eof.store(true, std::memory_order_release);
+}
+
+const void *StreamReplay::acquire() {
+    // eof is read first: all frames are written before eof is set
+    const bool ended = eof.load(std::memory_order_acquire);
+    const auto c     = consumed.load(std::memory_order_relaxed);
+    if (written.load(std::memory_order_acquire) == c) {
+        if (ended) end = true;
+        else ++underruns;
+        return nullptr;
+    }
+    return ring.get_addr() + c % slots * frame_size;
+}
+
+void StreamReplay::release() noexcept {
+    consumed.fetch_add(1, std::memory_order_release);
+    consumed.notify_one();
+}
+
+std::unique_ptr<ReplaySource>
+        open_replay(const std::string &path, std::size_t frame_size, std::size_t slots, bool loop) {
+    const int fd = path == "-" ? dup(STDIN_FILENO) : open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) throw std::system_error(errno, std::generic_category(), "failed to open '" + path + '\'');
+
+    struct stat st {};
+    if (fstat(fd, &st) == -1) {
+        const int tmp = errno;
+        close(fd);
+        throw std::system_error(tmp, std::generic_category(), "fstat '" + path + '\'');
+    }
+
+    if (S_ISREG(st.st_mode)) return std::make_unique<MappedReplay>(fd, frame_size, loop);
+
+    try {
+        return std::make_unique<StreamReplay>(fd, frame_size, slots);
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+}
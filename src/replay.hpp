@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "buffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+/**
+ * \brief source of recorded frames that are written instead of random data
+ * @details Every frame has the size of the written memory area. One frame is written per interval.
+ */
+class ReplaySource {
+protected:
+    std::size_t   frame_size;
+    std::uint64_t underruns = 0;
+
+    explicit ReplaySource(std::size_t frame_size) noexcept : frame_size(frame_size) {}
+
+public:
+    virtual ~ReplaySource() = default;
+
+    ReplaySource(const ReplaySource &)            = delete;
+    ReplaySource(ReplaySource &&)                 = delete;
+    ReplaySource &operator=(const ReplaySource &) = delete;
+    ReplaySource &operator=(ReplaySource &&)      = delete;
+
+    /**
+     * \brief get the next frame
+     * @details The frame is valid until release() is called.
+     * @return pointer to the frame (frame size bytes), nullptr if no frame is available (see finished())
+     */
+    [[nodiscard]] virtual const void *acquire() = 0;
+
+    /**
+     * \brief release the frame returned by acquire()
+     */
+    virtual void release() noexcept = 0;
+
+    /**
+     * \brief check if the end of the input is reached
+     * @return true if no more frames will be available
+     */
+    [[nodiscard]] virtual bool finished() const noexcept = 0;
+
+    /**
+     * \brief get the error that terminated the input
+     * @return errno of the failed read (0: no error)
+     */
+    [[nodiscard]] virtual int get_error() const noexcept { return 0; }
+
+    /**
+     * \brief get the frame size
+     * @return frame size in bytes
+     */
+    [[nodiscard]] std::size_t get_frame_size() const noexcept { return frame_size; }
+
+    /**
+     * \brief get the number of underruns
+     * @return number of calls of acquire() without an available frame (excluding the end of the input)
+     */
+    [[nodiscard]] std::uint64_t get_underruns() const noexcept { return underruns; }
+};
+
+/**
+ * \brief replay of a regular file via mmap
+ * @details The frames are copied directly from the page cache (no intermediate buffer).
+ *          The kernel reads ahead sequentially (MADV_SEQUENTIAL), the frame after the current one is requested with
+ *          MADV_WILLNEED. Bytes after the last complete frame are ignored.
+ */
+class MappedReplay final : public ReplaySource {
+private:
+    const std::uint8_t *addr = nullptr;
+    std::size_t         map_size;
+    std::size_t         frames;
+    std::size_t         index = 0;
+    bool                loop;
+    bool                end = false;
+
+public:
+    /**
+     * \brief map a capture file
+     * @param fd file descriptor of the file (is closed by the constructor)
+     * @param frame_size frame size in bytes
+     * @param loop start again with the first frame after the last frame
+     * @exception std::runtime_error the file does not contain a complete frame
+     * @exception std::system_error failed to map the file
+     */
+    MappedReplay(int fd, std::size_t frame_size, bool loop);
+
+    ~MappedReplay() override;
+
+    MappedReplay(const MappedReplay &)            = delete;
+    MappedReplay(MappedReplay &&)                 = delete;
+    MappedReplay &operator=(const MappedReplay &) = delete;
+    MappedReplay &operator=(MappedReplay &&)      = delete;
+
+    [[nodiscard]] const void *acquire() override;
+    void                      release() noexcept override;
+    [[nodiscard]] bool        finished() const noexcept override { return end; }
+
+    /**
+     * \brief get the number of frames in the file
+     * @return number of frames
+     */
+    [[nodiscard]] std::size_t get_frames() const noexcept { return frames; }
+};
+
+/**
+ * \brief replay of a pipe, FIFO or stdin
+ * @details A reader thread reads ahead into a ring buffer of frames. An interval without a complete frame in the
+ *          ring buffer is skipped (underrun), the replay ends with the end of the input.
+ *          A partial last frame is ignored.
+ *
+ *          The ring indices are only written by one thread each. The reader thread waits for a free slot with
+ *          std::atomic::wait, no lock is used on the writer side.
+ */
+class StreamReplay final : public ReplaySource {
+private:
+    int                        fd;
+    int                        event_fd;
+    std::size_t                slots;
+    PrivateBuffer              ring;
+    std::atomic<std::uint64_t> written {0};
+    std::atomic<std::uint64_t> consumed {0};
+    std::atomic<bool>          eof {false};
+    std::atomic<bool>          stop {false};
+    std::atomic<int>           error {0};
+    bool                       end = false;
+    std::thread                reader;
+
+    void read_loop();
+
+    /**
+     * \brief read one frame
+     * @return false if the input ended or the replay is stopped
+     */
+    bool read_frame(std::uint8_t *dst);
+
+public:
+    /**
+     * \brief start reading a stream
+     * @param fd file descriptor of the stream (is closed by the destructor)
+     * @param frame_size frame size in bytes
+     * @param slots number of frames in the ring buffer (>= 1)
+     * @exception std::invalid_argument slots == 0
+     * @exception std::system_error failed to allocate the ring buffer
+     */
+    StreamReplay(int fd, std::size_t frame_size, std::size_t slots);
+
+    ~StreamReplay() override;
+
+    StreamReplay(const StreamReplay &)            = delete;
+    StreamReplay(StreamReplay &&)                 = delete;
+    StreamReplay &operator=(const StreamReplay &) = delete;
+    StreamReplay &operator=(StreamReplay &&)      = delete;
+
+    [[nodiscard]] const void *acquire() override;
+    void                      release() noexcept override;
+    [[nodiscard]] bool        finished() const noexcept override { return end; }
+    [[nodiscard]] int         get_error() const noexcept override { return error.load(std::memory_order_relaxed); }
+};
+
+/**
+ * \brief open a replay source
+ * @details Regular files are replayed with MappedReplay, everything else (pipes, FIFOs, character devices) with
+ *          StreamReplay. Opening a FIFO blocks until a writer opens the FIFO.
+ * @param path path of the input ("-": stdin)
+ * @param frame_size frame size in bytes
+ * @param slots number of frames in the ring buffer of a StreamReplay
+ * @param loop replay a regular file in a loop
+ * @return replay source
+ * @exception std::system_error failed to open the input
+ * @exception std::runtime_error the file does not contain a complete frame
+ */
+std::unique_ptr<ReplaySource>
+        open_replay(const std::string &path, std::size_t frame_size, std::size_t slots, bool loop);
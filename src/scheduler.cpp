@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "scheduler.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <ctime>
+#include <sched.h>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
+#include <system_error>
+#include <unistd.h>
+
+static constexpr long NS_PER_S = 1000000000;
+
+/**
+ * \brief get the signal set that terminates the application
+ */
+static sigset_t termination_signals() {
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGINT);
+    sigaddset(&set, SIGTERM);
+    return set;
+}
+
+/**
+ * \brief convert a duration to a timespec
+ */
+static timespec to_timespec(std::chrono::nanoseconds duration) noexcept {
+    return {duration.count() / NS_PER_S, duration.count() % NS_PER_S};
+}
+
+void Scheduler::block_signals() {
+    const auto set = termination_signals();
+    const int  tmp = pthread_sigmask(SIG_BLOCK, &set, nullptr);
+    if (tmp != 0) throw std::system_error(tmp, std::generic_category(), "failed to block signals");
+}
+
+void Scheduler::unblock_signals() {
+    const auto set = termination_signals();
+    const int  tmp = pthread_sigmask(SIG_UNBLOCK, &set, nullptr);
+    if (tmp != 0) throw std::system_error(tmp, std::generic_category(), "failed to unblock signals");
+}
+
+bool Scheduler::termination_pending() noexcept {
+    sigset_t pending;
+    if (sigpending(&pending) == -1) return false;
+    return sigismember(&pending, SIGINT) == 1 || sigismember(&pending, SIGTERM) == 1;
+}
+
+void Scheduler::set_realtime(int priority) {
+    sched_param param {};
+    param.sched_priority = priority;
+    if (sched_setscheduler(0, SCHED_FIFO, &param) == -1)
+        throw std::system_error(errno, std::generic_category(), "failed to set SCHED_FIFO priority");
+}
+
+Scheduler::Scheduler(std::chrono::nanoseconds period, overrun_t overrun) : period(period), overrun(overrun) {
+    if (period.count() < 0) throw std::invalid_argument("period must not be negative");
+
+    try {
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd == -1) throw std::system_error(errno, std::generic_category(), "epoll_create1");
+
+        const auto set = termination_signals();
+        signal_fd      = signalfd(-1, &set, SFD_NONBLOCK | SFD_CLOEXEC);
+        if (signal_fd == -1) throw std::system_error(errno, std::generic_category(), "signalfd");
+
+        epoll_event event {};
+        event.events  = EPOLLIN;
+        event.data.fd = signal_fd;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, signal_fd, &event) == -1)
+            throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+
+        if (period.count() != 0) {
+            timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+            if (timer_fd == -1) throw std::system_error(errno, std::generic_category(), "timerfd_create");
+
+            event.data.fd = timer_fd;
+            if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd, &event) == -1)
+                throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+        }
+    } catch (...) {
+        if (timer_fd != -1) close(timer_fd);
+        if (signal_fd != -1) close(signal_fd);
+        if (epoll_fd != -1) close(epoll_fd);
+        throw;
+    }
+}
+
+Scheduler::~Scheduler() {
+    if (pid_fd != -1) close(pid_fd);
+    if (timer_fd != -1) close(timer_fd);
+    close(signal_fd);
+    close(epoll_fd);
+}
+
+void Scheduler::watch_process(pid_t pid) {
+    if (pid_fd != -1) throw std::logic_error("a process is already watched");
+
+    // no glibc wrapper before 2.36
+    const auto fd = syscall(SYS_pidfd_open, pid, 0);
+    if (fd == -1) throw std::system_error(errno, std::generic_category(), "pidfd_open");
+    pid_fd = static_cast<int>(fd);
+
+    epoll_event event {};
+    event.events  = EPOLLIN;
+    event.data.fd = pid_fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, pid_fd, &event) == -1) {
+        const int error = errno;
+        close(pid_fd);
+        pid_fd = -1;
+        throw std::system_error(error, std::generic_category(), "epoll_ctl");
+    }
+}
+
+void Scheduler::add_event_fd(int fd) {
+    if (event_fd != -1) throw std::logic_error("an event file descriptor is already added");
+
+    // edge triggered: the file descriptor stays readable until the caller reads it
+    epoll_event ev {};
+    ev.events  = EPOLLIN | EPOLLET;
+    ev.data.fd = fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1)
+        throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+    event_fd = fd;
+}
+
+void Scheduler::arm() {
+    itimerspec spec {};
+
+    if (overrun == overrun_t::DRIFT) {
+        // one shot timer, relative to the end of the current fill
+        spec.it_value = to_timespec(period);
+        if (timerfd_settime(timer_fd, 0, &spec, nullptr) == -1)
+            throw std::system_error(errno, std::generic_category(), "timerfd_settime");
+        return;
+    }
+
+    // periodic timer on an absolute time grid
+    timespec now {};
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == -1)
+        throw std::system_error(errno, std::generic_category(), "clock_gettime");
+
+    const auto start = std::chrono::seconds(now.tv_sec) + std::chrono::nanoseconds(now.tv_nsec) + period;
+    spec.it_value    = to_timespec(start);
+    spec.it_interval = to_timespec(period);
+    if (timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &spec, nullptr) == -1)
+        throw std::system_error(errno, std::generic_category(), "timerfd_settime");
+
+    armed = true;
+}
+
+std::chrono::steady_clock::time_point Scheduler::next_tick() const {
+    if (timer_fd == -1) return {};
+
+    const auto now = std::chrono::steady_clock::now();
+
+    itimerspec spec {};
+    if (timerfd_gettime(timer_fd, &spec) == -1)
+        throw std::system_error(errno, std::generic_category(), "timerfd_gettime");
+
+    const auto remaining = std::chrono::seconds(spec.it_value.tv_sec) + std::chrono::nanoseconds(spec.it_value.tv_nsec);
+    return now + (remaining.count() ? remaining : period);
+}
+
+std::size_t Scheduler::wait() {
+    if (timer_fd != -1 && !armed) arm();
+
+    const int timeout = timer_fd == -1 ? 0 : -1;
+
+    while (true) {
+        std::array<epoll_event, 4> events {};
+        const int n = epoll_wait(epoll_fd, events.data(), static_cast<int>(events.size()), timeout);
+        if (n == -1) {
+            if (errno == EINTR) continue;
+            throw std::system_error(errno, std::generic_category(), "epoll_wait");
+        }
+
+        std::uint64_t expirations = 0;
+        for (int i = 0; i < n; ++i) {
+            const auto fd = events[static_cast<std::size_t>(i)].data.fd;
+            if (fd == signal_fd) return 0;
+
+            // the pidfd becomes readable when the process exits
+            if (fd == pid_fd) {
+                exited = true;
+                return 0;
+            }
+
+            // handled by the caller between two ticks
+            if (fd == event_fd) event = true;
+
+            if (fd == timer_fd) {
+                if (read(timer_fd, &expirations, sizeof(expirations)) == -1) {
+                    if (errno == EAGAIN) continue;
+                    throw std::system_error(errno, std::generic_category(), "failed to read timerfd");
+                }
+            }
+        }
+
+        if (timer_fd == -1) return 1;
+        if (expirations == 0) continue;
+
+        if (overrun == overrun_t::CATCH_UP) return expirations;
+        if (overrun == overrun_t::SKIP) missed += expirations - 1;
+        return 1;
+    }
+}
+
+std::chrono::nanoseconds parse_duration(const std::string &str) {
+    std::size_t idx = 0;
+    double      value;
+    try {
+        value = std::stod(str, &idx);
+    } catch (const std::exception &) { throw std::invalid_argument("invalid duration '" + str + '\''); }
+
+    const auto unit = str.substr(idx);
+
+    double factor;
+    if (unit == "ns") factor = 1;
+    else if (unit == "us") factor = 1e3;                  // NOLINT
+    else if (unit == "ms" || unit.empty()) factor = 1e6;  // NOLINT
+    else if (unit == "s") factor = 1e9;                   // NOLINT
+    else throw std::invalid_argument("invalid duration '" + str + '\'');
+
+    const auto ns = std::round(value * factor);
+    if (!std::isfinite(ns) || ns < 0 || ns > 1e18) throw std::invalid_argument("invalid duration '" + str + '\'');
+
+    return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(ns));
+}
+
+Scheduler::overrun_t parse_overrun(const std::string &str) {
+    if (str == "skip") return Scheduler::overrun_t::SKIP;
+    if (str == "catch-up") return Scheduler::overrun_t::CATCH_UP;
+    if (str == "drift") return Scheduler::overrun_t::DRIFT;
+    throw std::invalid_argument("invalid overrun policy '" + str + '\'');
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <sys/types.h>
+#include <utility>
+
+/**
+ * \brief deadline scheduler based on timerfd (CLOCK_MONOTONIC) and epoll
+ * @details SIGINT and SIGTERM are received via signalfd in the same epoll set.
+ *          Therefore, block_signals() has to be called before any thread is created.
+ *          Optionally, the exit of a process is received via pidfd in the same epoll set (see watch_process()).
+ */
+class Scheduler {
+public:
+    //* handling of ticks that were missed because a fill took longer than one period
+    enum class overrun_t {
+        SKIP,      //*< skip the missed ticks, stay on the time grid
+        CATCH_UP,  //*< execute all missed ticks immediately, one after the other
+        DRIFT      //*< start the next period when the current fill is finished
+    };
+
+private:
+    std::chrono::nanoseconds period;
+    overrun_t                overrun;
+    int                      epoll_fd  = -1;
+    int                      timer_fd  = -1;
+    int                      signal_fd = -1;
+    int                      pid_fd    = -1;
+    int                      event_fd  = -1;
+    bool                     armed     = false;
+    bool                     exited    = false;
+    bool                     event     = false;
+    std::uint64_t            missed    = 0;
+
+    void arm();
+
+public:
+    /**
+     * \brief create scheduler
+     * @param period interval between two ticks (0: no waiting)
+     * @param overrun overrun policy
+     * @exception std::system_error failed to create timerfd, signalfd or epoll instance
+     */
+    Scheduler(std::chrono::nanoseconds period, overrun_t overrun);
+
+    ~Scheduler();
+
+    Scheduler(const Scheduler &)            = delete;
+    Scheduler(Scheduler &&)                 = delete;
+    Scheduler &operator=(const Scheduler &) = delete;
+    Scheduler &operator=(Scheduler &&)      = delete;
+
+    /**
+     * \brief wait for the next tick
+     * @details The first call arms the timer, so the first tick is one period after that call.
+     * @return number of ticks that have to be executed (0: SIGINT or SIGTERM received or watched process exited)
+     * @exception std::system_error wait failed
+     */
+    std::size_t wait();
+
+    /**
+     * \brief get the time of the next tick
+     * @details Before the first wait() and with overrun policy DRIFT (timer not armed), the next tick is one period
+     *          from now.
+     * @return time of the next tick (steady_clock::time_point(): period 0, no ticks)
+     * @exception std::system_error failed to read the timer
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point next_tick() const;
+
+    /**
+     * \brief watch a process
+     * @details A pidfd of the process is added to the wait set: wait() returns 0 as soon as the process exits,
+     *          without any polling while the process is alive.
+     * @param pid pid of the process
+     * @exception std::system_error failed to open the pidfd (ESRCH: no such process, ENOSYS: not supported)
+     */
+    void watch_process(pid_t pid);
+
+    /**
+     * \brief add a file descriptor to the wait set
+     * @details If the file descriptor becomes readable during wait(), a flag is set (see take_event()) and wait()
+     *          continues waiting for the next tick. The file descriptor is not read and not closed by the scheduler.
+     *          The caller has to read all pending data after take_event() returned true (edge triggered).
+     * @param fd file descriptor (e.g. inotify)
+     * @exception std::system_error failed to add the file descriptor
+     */
+    void add_event_fd(int fd);
+
+    /**
+     * \brief check and reset the event flag of the event file descriptor
+     * @return true if the event file descriptor became readable during a previous wait()
+     */
+    bool take_event() noexcept { return std::exchange(event, false); }
+
+    /**
+     * \brief check if the watched process exited
+     * @return true if wait() returned because the watched process exited
+     */
+    [[nodiscard]] bool process_exited() const noexcept { return exited; }
+
+    /**
+     * \brief get the number of skipped ticks (overrun policy SKIP)
+     * @return number of missed ticks
+     */
+    [[nodiscard]] std::uint64_t get_missed() const noexcept { return missed; }
+
+    /**
+     * \brief block SIGINT and SIGTERM for the calling thread and all threads that are created afterwards
+     * @exception std::system_error failed to change the signal mask
+     */
+    static void block_signals();
+
+    /**
+     * \brief unblock SIGINT and SIGTERM for the calling thread
+     * @details A termination signal that arrives while the signals are unblocked has its default action.
+     * @exception std::system_error failed to change the signal mask
+     */
+    static void unblock_signals();
+
+    /**
+     * \brief check if SIGINT or SIGTERM is pending
+     * @details The signal is not consumed, so it is still received by wait().
+     *          Used to interrupt blocking operations outside of wait() (see block_signals()).
+     * @return true if a termination signal is pending
+     */
+    static bool termination_pending() noexcept;
+
+    /**
+     * \brief switch the calling thread (and all threads that are created afterwards) to SCHED_FIFO
+     * @param priority real time priority
+     * @exception std::system_error failed to change the scheduling policy
+     */
+    static void set_realtime(int priority);
+};
+
+/**
+ * \brief parse a duration (e.g. "250us", "1.5ms", "2s", "100000ns"). A value without unit is interpreted as ms.
+ * @param str duration
+ * @return duration in nanoseconds
+ * @exception std::invalid_argument invalid duration
+ */
+std::chrono::nanoseconds parse_duration(const std::string &str);
+
+/**
+ * \brief parse an overrun policy (skip, catch-up or drift)
+ * @param str overrun policy
+ * @return overrun policy
+ * @exception std::invalid_argument invalid overrun policy
+ */
+Scheduler::overrun_t parse_overrun(const std::string &str);
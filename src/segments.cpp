@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "segments.hpp"
+
+#include <algorithm>
+#include <cxxsemaphore.hpp>
+#include <fstream>
+#include <stdexcept>
+
+SegmentSpec parse_segment(const std::string &spec) {
+    SegmentSpec segment;
+
+    // extract name and semaphore, the remaining keys describe the region
+    std::string region;
+    std::size_t pos = 0;
+    while (pos < spec.size()) {
+        const auto end  = std::min(spec.find(',', pos), spec.size());
+        const auto item = spec.substr(pos, end - pos);
+
+        if (item.starts_with("name=")) {
+            segment.name = item.substr(std::string("name=").size());
+        } else if (item.starts_with("semaphore=")) {
+            segment.semaphore = item.substr(std::string("semaphore=").size());
+            if (segment.semaphore->empty()) throw std::invalid_argument("invalid segment '" + spec + '\'');
+        } else {
+            if (!region.empty()) region += ',';
+            region += item;
+        }
+
+        pos = end + 1;
+    }
+
+    if (segment.name.empty()) throw std::invalid_argument("missing name in segment '" + spec + '\'');
+
+    segment.region = parse_region(region);
+    return segment;
+}
+
+std::vector<SegmentSpec> read_segment_manifest(const std::string &path) {
+    std::ifstream file(path);
+    if (!file) throw std::runtime_error("failed to open manifest '" + path + '\'');
+
+    std::vector<SegmentSpec> segments;
+    std::string              line;
+    while (std::getline(file, line)) {
+        const auto first = line.find_first_not_of(" \t");
+        if (first == std::string::npos || line[first] == '#') continue;
+        const auto last = line.find_last_not_of(" \t\r");
+        segments.push_back(parse_segment(line.substr(first, last - first + 1)));
+    }
+
+    if (file.bad()) throw std::runtime_error("failed to read manifest '" + path + '\'');
+
+    return segments;
+}
+
+bool write_segment(const SegmentSpec           &spec,
+                   ParallelFill                &filler,
+                   const SemaphoreSync::Policy &semaphore_policy,
+                   std::uint64_t                stream_id) {
+    const cxxshm::SharedMemory shm(spec.name);
+
+    auto region = spec.region;
+    region.interval.reset();
+    std::unique_ptr<RegionSet> regions;
+    try {
+        regions = std::make_unique<RegionSet>(
+                std::vector<RegionSpec> {region}, shm.get_size(), std::chrono::nanoseconds::zero());
+    } catch (const std::invalid_argument &e) {
+        throw std::invalid_argument("shared memory '" + spec.name + "': " + e.what());
+    }
+    regions->advance();
+
+    std::unique_ptr<FrameSync> sync;
+    if (spec.semaphore) {
+        sync = std::make_unique<SemaphoreSync>(std::make_unique<cxxsemaphore::Semaphore>(*spec.semaphore),
+                                               semaphore_policy);
+    }
+
+    if (sync && !sync->begin()) return false;
+    regions->fill(shm.get_addr<void *>(), filler, stream_id);
+    if (sync) sync->end();
+    return true;
+}
+
+SegmentDriver::SegmentDriver(const std::vector<SegmentSpec> &specs,
+                             std::chrono::nanoseconds        default_interval,
+                             const SemaphoreSync::Policy    &semaphore_policy)
+    : period(0) {
+    if (specs.empty()) throw std::invalid_argument("no segments");
+
+    std::vector<std::chrono::nanoseconds> intervals;
+    intervals.reserve(specs.size());
+    for (const auto &spec : specs)
+        intervals.push_back(spec.region.interval.value_or(default_interval));
+
+    period = RegionSet::common_period(intervals);
+
+    segments.reserve(specs.size());
+    for (std::size_t i = 0; i < specs.size(); ++i) {
+        const auto &spec = specs[i];
+        Segment     segment;
+
+        segment.shm = std::make_unique<cxxshm::SharedMemory>(spec.name);
+
+        // the interval is handled by the timing wheel, the region is written on every call
+        auto region = spec.region;
+        region.interval.reset();
+        try {
+            segment.region = std::make_unique<RegionSet>(
+                    std::vector<RegionSpec> {region}, segment.shm->get_size(), std::chrono::nanoseconds::zero());
+        } catch (const std::invalid_argument &e) {
+            throw std::invalid_argument("shared memory '" + spec.name + "': " + e.what());
+        }
+
+        if (spec.semaphore) {
+            auto policy    = semaphore_policy;
+            policy.timeout = intervals[i] / 2;
+            segment.sync   = std::make_unique<SemaphoreSync>(std::make_unique<cxxsemaphore::Semaphore>(*spec.semaphore),
+                                                           policy);
+        }
+
+        if (period.count() == 0) {
+            wheel.add(i, 1);
+        } else {
+            if (intervals[i].count() == 0)
+                throw std::invalid_argument("segment intervals can not be combined with an interval of 0");
+            wheel.add(i, static_cast<std::uint64_t>(intervals[i] / period));
+        }
+
+        segments.push_back(std::move(segment));
+    }
+}
+
+void SegmentDriver::tick(ParallelFill &filler, std::chrono::steady_clock::time_point next_tick) {
+    wheel.advance(due);
+
+    for (const auto index : due) {
+        auto &segment = segments[index];
+        segment.region->advance();
+
+        if (segment.sync && next_tick != std::chrono::steady_clock::time_point()) segment.sync->set_deadline(next_tick);
+
+        if (segment.sync && !segment.sync->begin()) continue;
+        segment.region->fill(segment.shm->get_addr<void *>(), filler, index);
+        if (segment.sync) segment.sync->end();
+    }
+}
+
+bool SegmentDriver::failed() const noexcept {
+    return std::any_of(segments.begin(), segments.end(), [](const Segment &segment) {
+        return segment.sync && segment.sync->failed();
+    });
+}
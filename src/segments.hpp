@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "parallel_fill.hpp"
+#include "region.hpp"
+#include "sync.hpp"
+#include "time_wheel.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cxxshm.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+//* specification of a shared memory segment
+struct SegmentSpec {
+    //* name of the shared memory
+    std::string name;
+
+    //* name of the semaphore (optional)
+    std::optional<std::string> semaphore;
+
+    //* memory area of the segment that is written (and interval)
+    RegionSpec region;
+};
+
+/**
+ * \brief parse a segment specification
+ * @details Format: like parse_region with the additional keys name (mandatory) and semaphore.
+ *          Example: name=mem1,semaphore=sem1,offset=64,elements=16,alignment=4,mask=ff,interval=10ms
+ * @param spec segment specification
+ * @return segment
+ * @exception std::invalid_argument invalid specification
+ */
+SegmentSpec parse_segment(const std::string &spec);
+
+/**
+ * \brief read segment specifications from a manifest file
+ * @details One segment specification per line (see parse_segment). Empty lines and lines starting with # are ignored.
+ * @param path path of the file
+ * @return segments
+ * @exception std::runtime_error failed to read the file
+ * @exception std::invalid_argument invalid specification
+ */
+std::vector<SegmentSpec> read_segment_manifest(const std::string &path);
+
+/**
+ * \brief write a segment once
+ * @details Opens the shared memory (and semaphore), fills the memory area of the segment and closes it again.
+ *          The interval of the segment is ignored.
+ * @param spec segment specification
+ * @param filler (multi threaded) random data generator
+ * @param semaphore_policy acquisition policy of the semaphore
+ * @param stream_id random stream of the segment (reproducible mode)
+ * @return false if the segment was skipped (semaphore not available, see SemaphoreSync)
+ * @exception std::invalid_argument segment specification does not fit the shared memory
+ * @exception std::exception failed to open the shared memory or semaphore
+ */
+bool write_segment(const SegmentSpec           &spec,
+                   ParallelFill                &filler,
+                   const SemaphoreSync::Policy &semaphore_policy,
+                   std::uint64_t                stream_id);
+
+/**
+ * \brief fill multiple shared memories with individual intervals
+ * @details The tick period is the greatest common divisor of all segment intervals (see RegionSet::common_period).
+ *          The segments are scheduled by a single timing wheel and filled by the same worker pool.
+ */
+class SegmentDriver {
+    struct Segment {
+        std::unique_ptr<cxxshm::SharedMemory> shm;
+        std::unique_ptr<SemaphoreSync>        sync;
+        std::unique_ptr<RegionSet>            region;
+    };
+
+    std::vector<Segment>     segments;
+    TimeWheel                wheel;
+    std::vector<std::size_t> due;
+    std::chrono::nanoseconds period;
+
+public:
+    /**
+     * \brief open all segments
+     * @param specs segment specifications
+     * @param default_interval interval of segments without interval (0: segments are written every tick)
+     * @param semaphore_policy acquisition policy of the semaphores. The timeout is half the interval of the segment.
+     * @exception std::invalid_argument segment specification does not fit the shared memory or invalid interval
+     * @exception std::exception failed to open a shared memory or semaphore
+     */
+    SegmentDriver(const std::vector<SegmentSpec> &specs,
+                  std::chrono::nanoseconds        default_interval,
+                  const SemaphoreSync::Policy    &semaphore_policy = {});
+
+    /**
+     * \brief get the tick period
+     * @return tick period (0: every segment is written every tick)
+     */
+    [[nodiscard]] std::chrono::nanoseconds get_period() const noexcept { return period; }
+
+    /**
+     * \brief write all segments that are due in the next tick
+     * @details With semaphore strategy DEADLINE, the deadline of all segments is the next tick:
+     *          a longer wait would delay the segments that are due in the next tick.
+     * @param filler (multi threaded) random data generator
+     * @param next_tick time of the next tick (see Scheduler::next_tick; steady_clock::time_point(): no deadline)
+     */
+    void tick(ParallelFill &filler, std::chrono::steady_clock::time_point next_tick = {});
+
+    /**
+     * \brief check if the synchronization of at least one segment failed
+     * @return true if the application should terminate
+     */
+    [[nodiscard]] bool failed() const noexcept;
+
+    /**
+     * \brief get the number of segments
+     * @return number of segments
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return segments.size(); }
+
+    /**
+     * \brief get the shared memory of a segment
+     * @param index segment index
+     * @return shared memory
+     */
+    [[nodiscard]] const cxxshm::SharedMemory &get_shm(std::size_t index) const { return *segments.at(index).shm; }
+};
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "shm_watch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+/**
+ * \brief remove the leading slash of a POSIX IPC name
+ */
+static std::string strip_slash(const std::string &name) {
+    return !name.empty() && name.front() == '/' ? name.substr(1) : name;
+}
+
+ShmWatch::ShmWatch() {
+    inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd == -1) throw std::system_error(errno, std::generic_category(), "inotify_init1");
+
+    // IN_CREATE/IN_MOVED_TO: shm_open/sem_open, IN_MODIFY: ftruncate after shm_open
+    if (inotify_add_watch(inotify_fd, SHM_DIR, IN_CREATE | IN_MOVED_TO | IN_MODIFY | IN_ATTRIB) == -1) {
+        const int error = errno;
+        close(inotify_fd);
+        throw std::system_error(error, std::generic_category(), std::string("inotify_add_watch ") + SHM_DIR);
+    }
+}
+
+ShmWatch::~ShmWatch() {
+    close(inotify_fd);
+}
+
+std::string ShmWatch::shm_file(const std::string &name) {
+    return strip_slash(name);
+}
+
+std::string ShmWatch::semaphore_file(const std::string &name) {
+    // glibc stores named semaphores as sem.<name>
+    return "sem." + strip_slash(name);
+}
+
+/**
+ * \brief get the status of an object
+ * @param file file name in ShmWatch::SHM_DIR
+ * @param fd file descriptor (-1: stat the file)
+ * @param st status
+ * @return 0 on success, errno otherwise
+ */
+static int get_status(const std::string &file, int fd, struct stat &st) {
+    const int tmp = fd == -1 ? stat((std::string(ShmWatch::SHM_DIR) + '/' + file).c_str(), &st) : fstat(fd, &st);
+    return tmp == -1 ? errno : 0;
+}
+
+std::size_t ShmWatch::add(const std::string &file, int fd) {
+    struct stat st {};
+    const int   error = get_status(file, fd, st);
+    if (error) throw std::system_error(error, std::generic_category(), "failed to stat '" + file + '\'');
+
+    entries.push_back({file, st.st_ino, st.st_dev, false});
+    return entries.size() - 1;
+}
+
+void ShmWatch::check(Entry &entry) const {
+    struct stat st {};
+    if (get_status(entry.file, -1, st)) return;  // removed (and not yet recreated)
+
+    // an object is only complete after it was resized by its creator
+    entry.recreated = (st.st_ino != entry.inode || st.st_dev != entry.device) && st.st_size > 0;
+}
+
+bool ShmWatch::poll() {
+    alignas(inotify_event) std::array<char, 4096> buffer;  // NOLINT
+
+    bool any = false;
+    while (true) {
+        const auto n = read(inotify_fd, buffer.data(), buffer.size());
+        if (n == -1) {
+            if (errno == EAGAIN) break;
+            if (errno == EINTR) continue;
+            throw std::system_error(errno, std::generic_category(), "failed to read inotify events");
+        }
+
+        for (std::size_t pos = 0; pos < static_cast<std::size_t>(n);) {
+            inotify_event event {};
+            std::memcpy(&event, buffer.data() + pos, sizeof(event));
+            const std::string name = event.len ? buffer.data() + pos + sizeof(event) : "";
+            pos += sizeof(event) + event.len;
+
+            // queue overflow: check all files
+            const bool overflow = event.mask & IN_Q_OVERFLOW;
+            for (auto &entry : entries) {
+                if (overflow || entry.file == name) {
+                    check(entry);
+                    any = true;
+                }
+            }
+        }
+    }
+
+    return any && pending();
+}
+
+bool ShmWatch::pending() const noexcept {
+    return std::any_of(entries.begin(), entries.end(), [](const Entry &entry) { return entry.recreated; });
+}
+
+void ShmWatch::update(std::size_t id, int fd) {
+    auto       &entry = entries.at(id);
+    struct stat st {};
+    const int   error = get_status(entry.file, fd, st);
+    if (error) throw std::system_error(error, std::generic_category(), "failed to stat '" + entry.file + '\'');
+
+    entry.inode     = st.st_ino;
+    entry.device    = st.st_dev;
+    entry.recreated = false;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+/**
+ * \brief detect shared memories and semaphores that are recreated by their owner
+ * @details Uses inotify on /dev/shm. A file is marked as recreated if a file with the same name but a different
+ *          inode (or device) and a size > 0 exists. The inotify file descriptor can be added to an epoll set, so
+ *          nothing has to be polled as long as nothing in /dev/shm changes.
+ */
+class ShmWatch {
+public:
+    //* directory of the POSIX shared memories and named semaphores
+    static constexpr const char *SHM_DIR = "/dev/shm";
+
+private:
+    struct Entry {
+        std::string file;       //*< file name in SHM_DIR
+        ino_t       inode;      //*< inode of the currently used object
+        dev_t       device;     //*< device of the currently used object
+        bool        recreated;  //*< a new object with the same name exists
+    };
+
+    int                inotify_fd = -1;
+    std::vector<Entry> entries;
+
+    void check(Entry &entry) const;
+
+public:
+    /**
+     * \brief create watch
+     * @exception std::system_error failed to create the inotify instance
+     */
+    ShmWatch();
+
+    ~ShmWatch();
+
+    ShmWatch(const ShmWatch &)            = delete;
+    ShmWatch(ShmWatch &&)                 = delete;
+    ShmWatch &operator=(const ShmWatch &) = delete;
+    ShmWatch &operator=(ShmWatch &&)      = delete;
+
+    /**
+     * \brief get the file name of a shared memory
+     * @param name name of the shared memory
+     * @return file name in SHM_DIR
+     */
+    static std::string shm_file(const std::string &name);
+
+    /**
+     * \brief get the file name of a named semaphore
+     * @param name name of the semaphore
+     * @return file name in SHM_DIR
+     */
+    static std::string semaphore_file(const std::string &name);
+
+    /**
+     * \brief watch a file
+     * @param file file name in SHM_DIR
+     * @param fd file descriptor of the currently used object (-1: use the file that currently exists)
+     * @return id of the file
+     * @exception std::system_error failed to stat the file
+     */
+    std::size_t add(const std::string &file, int fd = -1);
+
+    /**
+     * \brief get the inotify file descriptor (readable if there are pending events)
+     * @return file descriptor
+     */
+    [[nodiscard]] int get_fd() const noexcept { return inotify_fd; }
+
+    /**
+     * \brief process all pending inotify events
+     * @return true if at least one watched file is recreated
+     * @exception std::system_error failed to read the events
+     */
+    bool poll();
+
+    /**
+     * \brief check if a watched file is recreated
+     * @param id id of the file
+     * @return true if recreated
+     */
+    [[nodiscard]] bool is_recreated(std::size_t id) const { return entries.at(id).recreated; }
+
+    /**
+     * \brief check if a re-check is required
+     * @return true if at least one watched file is recreated
+     */
+    [[nodiscard]] bool pending() const noexcept;
+
+    /**
+     * \brief update the currently used object of a watched file
+     * @param id id of the file
+     * @param fd file descriptor of the new object (-1: use the file that currently exists)
+     * @exception std::system_error failed to stat the file
+     */
+    void update(std::size_t id, int fd = -1);
+};
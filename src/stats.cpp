@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "stats.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <stdexcept>
+#include <unistd.h>
+
+static_assert(sizeof(StatsData) % sizeof(std::uint64_t) == 0);
+
+/**
+ * \brief atomically load a value of the statistics
+ */
+static std::uint64_t load(const std::uint64_t &value) noexcept {
+    auto &ref = const_cast<std::uint64_t &>(value);  // NOLINT
+    return std::atomic_ref<std::uint64_t>(ref).load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief atomically store a value of the statistics
+ */
+static void store(std::uint64_t &value, std::uint64_t new_value) noexcept {
+    std::atomic_ref<std::uint64_t>(value).store(new_value, std::memory_order_relaxed);
+}
+
+static std::uint64_t realtime_ns() noexcept {
+    timespec now {};
+    clock_gettime(CLOCK_REALTIME, &now);
+    return static_cast<std::uint64_t>(now.tv_sec) * 1000000000 + static_cast<std::uint64_t>(now.tv_nsec);  // NOLINT
+}
+
+StatsExport::StatsExport(const std::string &shm_name)
+    : shm(std::make_unique<cxxshm::SharedMemory>(
+              stats_name(shm_name), sizeof(StatsData), false, false, 0644)),  // NOLINT
+      data(shm->get_addr<StatsData *>()) {
+    std::memset(data, 0, sizeof(StatsData));
+    data->magic   = MAGIC;
+    data->version = VERSION;
+    data->pid     = static_cast<std::uint32_t>(getpid());
+    store(data->update_time, realtime_ns());
+}
+
+void StatsExport::record_fill(std::size_t              bytes,
+                              std::chrono::nanoseconds sync_wait,
+                              std::chrono::nanoseconds fill) noexcept {
+    const auto wait_ns = static_cast<std::uint64_t>(sync_wait.count());
+    const auto fill_ns = static_cast<std::uint64_t>(fill.count());
+
+    // single writer: load + store instead of atomic read modify write
+    store(data->fills, load(data->fills) + 1);
+    store(data->bytes, load(data->bytes) + bytes);
+    store(data->last_fill, fill_ns);
+    if (fill_ns > load(data->max_fill)) store(data->max_fill, fill_ns);
+    store(data->last_sync_wait, wait_ns);
+    if (wait_ns > load(data->max_sync_wait)) store(data->max_sync_wait, wait_ns);
+
+    const auto bucket = std::min<std::size_t>(std::bit_width(wait_ns / 1000), StatsData::HIST_BUCKETS - 1);  // NOLINT
+    store(data->sync_wait_hist[bucket], load(data->sync_wait_hist[bucket]) + 1);
+}
+
+void StatsExport::set_perf(const PerfCounters *counters) noexcept {
+    perf = counters;
+    store(data->perf_events, perf ? perf->get_available() : 0);
+}
+
+void StatsExport::record_perf(StatsData::perf_phase_t phase, const PerfCounters::Sample &counters) noexcept {
+    store(data->perf_ticks[phase], load(data->perf_ticks[phase]) + 1);
+    for (std::size_t i = 0; i < PerfCounters::EVENTS; ++i) {
+        store(data->perf_last[phase][i], counters[i]);
+        store(data->perf_total[phase][i], load(data->perf_total[phase][i]) + counters[i]);
+    }
+}
+
+void StatsExport::update(std::uint64_t missed_ticks, std::uint64_t sync_errors) noexcept {
+    store(data->missed_ticks, missed_ticks);
+    store(data->sync_errors, sync_errors);
+    store(data->update_time, realtime_ns());
+}
+
+void StatsExport::update_rate(double target, double achieved) noexcept {
+    store(data->target_rate, static_cast<std::uint64_t>(target));
+    store(data->achieved_rate, static_cast<std::uint64_t>(achieved));
+}
+
+void StatsExport::print(const std::string &shm_name, std::ostream &o) {
+    const cxxshm::SharedMemory stats_shm(stats_name(shm_name), true);
+    if (stats_shm.get_size() < sizeof(StatsData)) throw std::runtime_error("invalid statistics shared memory");
+
+    const auto &stats = *stats_shm.get_addr<const StatsData *>();
+    if (stats.magic != MAGIC) throw std::runtime_error("invalid statistics shared memory");
+    if (stats.version != VERSION)
+        throw std::runtime_error("unsupported statistics version " + std::to_string(stats.version));
+
+    const auto update_time = load(stats.update_time);
+    const auto now         = realtime_ns();
+    const auto age_ms      = now > update_time ? (now - update_time) / 1000000 : 0;  // NOLINT
+
+    o << "statistics of '" << shm_name << "' (pid " << stats.pid << ")" << '\n';
+    o << "  last update:      " << age_ms << " ms ago" << '\n';
+    o << "  fills:            " << load(stats.fills) << '\n';
+    o << "  bytes written:    " << load(stats.bytes) << '\n';
+    o << "  last fill:        " << load(stats.last_fill) << " ns" << '\n';
+    o << "  max fill:         " << load(stats.max_fill) << " ns" << '\n';
+    o << "  last sync wait:   " << load(stats.last_sync_wait) << " ns" << '\n';
+    o << "  max sync wait:    " << load(stats.max_sync_wait) << " ns" << '\n';
+    o << "  missed ticks:     " << load(stats.missed_ticks) << '\n';
+    o << "  sync errors:      " << load(stats.sync_errors) << '\n';
+    if (load(stats.target_rate)) {
+        o << "  target rate:      " << load(stats.target_rate) << " bytes/s" << '\n';
+        o << "  achieved rate:    " << load(stats.achieved_rate) << " bytes/s" << '\n';
+    }
+    o << "  sync wait histogram:" << '\n';
+    for (std::size_t i = 0; i < StatsData::HIST_BUCKETS; ++i) {
+        if (i + 1 < StatsData::HIST_BUCKETS)
+            o << "    <  " << std::setw(5) << (1U << i) << " us: ";  // NOLINT
+        else
+            o << "    >= " << std::setw(5) << (1U << (i - 1)) << " us: ";  // NOLINT
+        o << load(stats.sync_wait_hist[i]) << '\n';
+    }
+
+    const auto perf_events = load(stats.perf_events);
+    if (!perf_events) return;
+
+    static constexpr std::array<const char *, StatsData::PERF_PHASES> PHASE_NAMES {"sync", "fill", "copy"};
+    static constexpr int                                               WIDTH = 14;
+
+    o << "  perf counters:    " << std::setw(WIDTH) << "ticks";
+    for (std::size_t i = 0; i < PerfCounters::EVENTS; ++i)
+        o << std::setw(WIDTH) << PerfCounters::event_name(i);
+    o << '\n';
+
+    for (std::size_t phase = 0; phase < StatsData::PERF_PHASES; ++phase) {
+        const auto ticks = load(stats.perf_ticks[phase]);
+        if (ticks == 0) continue;
+
+        for (const bool last : {true, false}) {
+            o << "    " << std::setw(4) << std::left << PHASE_NAMES[phase] << (last ? " (last): " : " (avg):  ")
+              << std::right << std::setw(WIDTH);
+            if (last) o << "";
+            else o << ticks;
+            for (std::size_t i = 0; i < PerfCounters::EVENTS; ++i) {
+                o << std::setw(WIDTH);
+                if (!(perf_events & (std::uint64_t {1} << i))) o << "n/a";
+                else if (last) o << load(stats.perf_last[phase][i]);
+                else o << load(stats.perf_total[phase][i]) / ticks;
+            }
+            o << '\n';
+        }
+    }
+}
+
+FillProbe::FillProbe(StatsExport *stats) noexcept : stats(stats) {
+    if (!stats) return;
+    start = std::chrono::steady_clock::now();
+    if (const auto *perf = stats->get_perf()) last = perf->read();
+}
+
+void FillProbe::synced() noexcept {
+    if (!stats) return;
+    synced_at = std::chrono::steady_clock::now();
+    phase(StatsData::PERF_SYNC);
+}
+
+void FillProbe::phase(StatsData::perf_phase_t phase) noexcept {
+    if (!stats) return;
+    const auto *perf = stats->get_perf();
+    if (!perf) return;
+
+    const auto now = perf->read();
+    stats->record_perf(phase, PerfCounters::diff(now, last));
+    last = now;
+}
+
+void FillProbe::finish(StatsData::perf_phase_t phase, std::size_t bytes) noexcept {
+    if (!stats) return;
+    const auto now = std::chrono::steady_clock::now();
+    this->phase(phase);
+    stats->record_fill(bytes, synced_at - start, now - synced_at);
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "perf_counters.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cxxshm.hpp>
+#include <memory>
+#include <ostream>
+#include <string>
+
+/**
+ * \brief content of the statistics shared memory
+ * @details All counters are 64 bit unsigned integers in native endianness.
+ *          They are written by a single writer with relaxed atomic stores.
+ *          Readers have to load every value atomically, the values are not consistent to each other.
+ *
+ *          Bucket 0 of the sync wait histogram counts waits < 1 us,
+ *          bucket i (1 <= i < 15) counts waits in [2^(i-1) us, 2^i us),
+ *          bucket 15 counts waits >= 16384 us.
+ *
+ *          The perf counters (--perf-counters) are measured per phase of a tick: the sync wait, the generation of
+ *          random data (fill) and the copy of pre generated or replayed data (copy).
+ *          The average per tick is perf_total / perf_ticks.
+ */
+struct StatsData {
+    static constexpr std::size_t HIST_BUCKETS = 16;
+
+    //* phases of a tick with perf counters
+    enum perf_phase_t : std::size_t { PERF_SYNC, PERF_FILL, PERF_COPY };
+
+    //* number of phases
+    static constexpr std::size_t PERF_PHASES = 3;
+
+    std::array<char, 8>                     magic;           //*< "SMRSTATS"
+    std::uint32_t                           version;         //*< layout version
+    std::uint32_t                           pid;             //*< pid of the writer
+    std::uint64_t                           update_time;     //*< last update (CLOCK_REALTIME, ns)
+    std::uint64_t                           fills;           //*< completed fills
+    std::uint64_t                           bytes;           //*< bytes written
+    std::uint64_t                           last_fill;       //*< duration of the last fill (ns)
+    std::uint64_t                           max_fill;        //*< maximum fill duration (ns)
+    std::uint64_t                           last_sync_wait;  //*< duration of the last sync wait (ns)
+    std::uint64_t                           max_sync_wait;   //*< maximum sync wait (ns)
+    std::uint64_t                           missed_ticks;    //*< ticks skipped by the scheduler
+    std::uint64_t                           sync_errors;     //*< error counter of the sync (semaphore)
+    std::uint64_t                           target_rate;     //*< target rate of --rate (bytes/s, 0: no rate)
+    std::uint64_t                           achieved_rate;   //*< achieved rate of --rate (bytes/s)
+    std::array<std::uint64_t, 3>            reserved;        //*< reserved, 0
+    std::array<std::uint64_t, HIST_BUCKETS> sync_wait_hist;  //*< sync wait histogram
+
+    std::uint64_t                                 perf_events;  //*< available perf counters (bit i: event i, 0: off)
+    std::array<std::uint64_t, PERF_PHASES>        perf_ticks;   //*< measured ticks per phase
+    std::array<PerfCounters::Sample, PERF_PHASES> perf_last;    //*< perf counters of the last tick per phase
+    std::array<PerfCounters::Sample, PERF_PHASES> perf_total;   //*< sum of the perf counters per phase
+};
+
+/**
+ * \brief runtime statistics, exported via the shared memory <name>.stats
+ * @details Only plain stores are used on the hot path (no locks, no read modify write operations).
+ */
+class StatsExport {
+public:
+    //* layout version
+    static constexpr std::uint32_t VERSION = 2;
+
+    //* magic value at the start of the statistics
+    static constexpr std::array<char, 8> MAGIC {'S', 'M', 'R', 'S', 'T', 'A', 'T', 'S'};
+
+private:
+    std::unique_ptr<cxxshm::SharedMemory> shm;
+    StatsData                            *data;
+    const PerfCounters                   *perf = nullptr;
+
+public:
+    /**
+     * \brief create the statistics shared memory
+     * @details An existing statistics shared memory with the same name is replaced.
+     * @param shm_name name of the shared memory that contains the random data
+     * @exception std::exception failed to create the shared memory
+     */
+    explicit StatsExport(const std::string &shm_name);
+
+    /**
+     * \brief get the name of the statistics shared memory
+     * @param shm_name name of the shared memory that contains the random data
+     * @return name of the statistics shared memory
+     */
+    static std::string stats_name(const std::string &shm_name) { return shm_name + ".stats"; }
+
+    /**
+     * \brief record a completed fill
+     * @param bytes number of bytes written
+     * @param sync_wait time required to acquire the sync (e.g. semaphore)
+     * @param fill duration of the fill (excluding the sync wait)
+     */
+    void record_fill(std::size_t bytes, std::chrono::nanoseconds sync_wait, std::chrono::nanoseconds fill) noexcept;
+
+    /**
+     * \brief measure the perf counters of every tick
+     * @param counters perf counters (nullptr: no perf counters), must outlive this object
+     */
+    void set_perf(const PerfCounters *counters) noexcept;
+
+    /**
+     * \brief get the perf counters
+     * @return perf counters (nullptr: no perf counters)
+     */
+    [[nodiscard]] const PerfCounters *get_perf() const noexcept { return perf; }
+
+    /**
+     * \brief record the perf counters of a phase of a tick
+     * @param phase phase
+     * @param counters counter values of the phase
+     */
+    void record_perf(StatsData::perf_phase_t phase, const PerfCounters::Sample &counters) noexcept;
+
+    /**
+     * \brief update the counters that are maintained by other components
+     * @param missed_ticks ticks skipped by the scheduler
+     * @param sync_errors error counter of the sync
+     */
+    void update(std::uint64_t missed_ticks, std::uint64_t sync_errors) noexcept;
+
+    /**
+     * \brief update the rate of --rate
+     * @param target target rate (bytes/s)
+     * @param achieved achieved rate (bytes/s)
+     */
+    void update_rate(double target, double achieved) noexcept;
+
+    /**
+     * \brief print the statistics of a running instance
+     * @param shm_name name of the shared memory that contains the random data
+     * @param o output stream
+     * @exception std::runtime_error no valid statistics found
+     * @exception std::exception failed to open the shared memory
+     */
+    static void print(const std::string &shm_name, std::ostream &o);
+};
+
+/**
+ * \brief measurement of one tick of the main loop
+ * @details Measures the sync wait and the write time (see StatsExport::record_fill) and, if enabled, the perf
+ *          counters of every phase. Nothing is measured without statistics.
+ *
+ *          Usage: construct before the sync wait, call synced() when the sync is acquired, phase() after every
+ *          further phase and finish() after the write.
+ */
+class FillProbe {
+private:
+    StatsExport                          *stats;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point synced_at;
+    PerfCounters::Sample                  last {};
+
+public:
+    /**
+     * \brief start the measurement of a tick (before the sync wait)
+     * @param stats runtime statistics (nullptr: no measurement)
+     */
+    explicit FillProbe(StatsExport *stats) noexcept;
+
+    /**
+     * \brief end of the sync wait
+     */
+    void synced() noexcept;
+
+    /**
+     * \brief end of a phase (perf counters only)
+     * @param phase phase that ended (since the sync wait or the previous phase)
+     */
+    void phase(StatsData::perf_phase_t phase) noexcept;
+
+    /**
+     * \brief end of the write
+     * @param phase phase that ended (fill or copy)
+     * @param bytes number of bytes written
+     */
+    void finish(StatsData::perf_phase_t phase, std::size_t bytes) noexcept;
+};
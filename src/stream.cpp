@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "stream.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <immintrin.h>
+#    define STREAM_X86
+#endif
+
+static constexpr std::size_t VECTOR_BLOCK = 64;
+
+using kernel_t = void (*)(void *dst, const void *src, std::size_t blocks);
+
+/**
+ * \brief portable kernel (normal stores)
+ */
+[[maybe_unused]] static void kernel_memcpy(void *dst, const void *src, std::size_t blocks) {
+    std::memcpy(dst, src, blocks * VECTOR_BLOCK);
+}
+
+#ifdef STREAM_X86
+/**
+ * \brief SSE2 kernel (4 x 128 bit per block)
+ */
+static void kernel_sse2(void *dst, const void *src, std::size_t blocks) {
+    auto       *out = static_cast<__m128i *>(dst);
+    const auto *in  = static_cast<const __m128i *>(src);
+    for (std::size_t i = 0; i < blocks * 4; ++i)
+        _mm_stream_si128(out + i, _mm_load_si128(in + i));
+}
+
+/**
+ * \brief AVX2 kernel (2 x 256 bit per block)
+ */
+__attribute__((target("avx2"))) static void kernel_avx2(void *dst, const void *src, std::size_t blocks) {
+    auto       *out = static_cast<__m256i *>(dst);
+    const auto *in  = static_cast<const __m256i *>(src);
+    for (std::size_t i = 0; i < blocks * 2; ++i)
+        _mm256_stream_si256(out + i, _mm256_load_si256(in + i));
+}
+
+/**
+ * \brief AVX-512 kernel (1 x 512 bit per block)
+ */
+__attribute__((target("avx512f"))) static void kernel_avx512(void *dst, const void *src, std::size_t blocks) {
+    auto       *out = static_cast<__m512i *>(dst);
+    const auto *in  = static_cast<const __m512i *>(src);
+    for (std::size_t i = 0; i < blocks; ++i)
+        _mm512_stream_si512(out + i, _mm512_load_si512(in + i));
+}
+#endif
+
+struct StreamKernel {
+    kernel_t    function;
+    const char *name;
+};
+
+/**
+ * \brief select the best kernel for this machine
+ * @return selected kernel
+ */
+static const StreamKernel &get_kernel() noexcept {
+    static const StreamKernel KERNEL = []() -> StreamKernel {
+#ifdef STREAM_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return {kernel_avx512, "avx512"};
+        if (__builtin_cpu_supports("avx2")) return {kernel_avx2, "avx2"};
+        return {kernel_sse2, "sse2"};
+#else
+        return {kernel_memcpy, "memcpy"};
+#endif
+    }();
+    return KERNEL;
+}
+
+void stream_copy(void *dst, const void *src, std::size_t size) noexcept {
+    auto       *out = static_cast<std::uint8_t *>(dst);
+    const auto *in  = static_cast<const std::uint8_t *>(src);
+
+    // head: align the destination to 64 bytes
+    const auto misalignment = reinterpret_cast<std::uintptr_t>(out) % VECTOR_BLOCK;  // NOLINT
+    if (misalignment) {
+        const auto head = std::min(size, VECTOR_BLOCK - misalignment);
+        std::memcpy(out, in, head);
+        out += head;
+        in += head;
+        size -= head;
+    }
+
+    // the source is only aligned if the destination was already aligned
+    const auto blocks = size / VECTOR_BLOCK;
+    if (blocks) {
+        if (reinterpret_cast<std::uintptr_t>(in) % VECTOR_BLOCK == 0) get_kernel().function(out, in, blocks);  // NOLINT
+        else std::memcpy(out, in, blocks * VECTOR_BLOCK);
+    }
+    out += blocks * VECTOR_BLOCK;
+    in += blocks * VECTOR_BLOCK;
+    size -= blocks * VECTOR_BLOCK;
+
+    if (size) std::memcpy(out, in, size);
+}
+
+void stream_fence() noexcept {
+#ifdef STREAM_X86
+    _mm_sfence();
+#else
+    std::atomic_thread_fence(std::memory_order_release);
+#endif
+}
+
+const char *stream_kernel_name() noexcept {
+    return get_kernel().name;
+}
+
+std::size_t last_level_cache_size() noexcept {
+#ifdef _SC_LEVEL3_CACHE_SIZE
+    const auto l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (l3 > 0) return static_cast<std::size_t>(l3);
+#endif
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    const auto l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (l2 > 0) return static_cast<std::size_t>(l2);
+#endif
+    return 0;
+}
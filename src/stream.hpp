@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * \brief copy data with non-temporal (streaming) stores
+ * @details The destination is written with non-temporal stores that bypass the cache (no read for ownership).
+ *          The unaligned head and tail of the destination (< 64 bytes) are written with normal stores.
+ *          Falls back to memcpy on architectures without streaming stores.
+ *
+ *          The stores are weakly ordered: call stream_fence() before the data is published.
+ * @param dst destination
+ * @param src source (must be 64 byte aligned)
+ * @param size number of bytes
+ */
+void stream_copy(void *dst, const void *src, std::size_t size) noexcept;
+
+/**
+ * \brief order all previous streaming stores of the calling thread before all subsequent stores (sfence)
+ */
+void stream_fence() noexcept;
+
+/**
+ * \brief get the name of the streaming store implementation that is used on this machine
+ * @return name of the implementation (avx512, avx2, sse2 or memcpy)
+ */
+const char *stream_kernel_name() noexcept;
+
+/**
+ * \brief get the size of the last level cache
+ * @return size in bytes (0: unknown)
+ */
+std::size_t last_level_cache_size() noexcept;
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "stripe_lock.hpp"
+
+#include "futex.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+static constexpr std::size_t OFFSET_VERSION     = 8;
+static constexpr std::size_t OFFSET_DATA_OFFSET = 16;
+static constexpr std::size_t OFFSET_DATA_SIZE   = 24;
+static constexpr std::size_t OFFSET_STRIPE_SIZE = 32;
+static constexpr std::size_t OFFSET_STRIPES     = 40;
+
+static constexpr std::uint32_t UNLOCKED  = 0;
+static constexpr std::uint32_t LOCKED    = 1;
+static constexpr std::uint32_t CONTENDED = 2;
+
+std::size_t StripeLocks::table_size(std::size_t data_size, std::size_t stripe_size) noexcept {
+    const auto stripes = (data_size + stripe_size - 1) / stripe_size;
+    const auto size    = HEADER_SIZE + stripes * sizeof(std::uint32_t);
+    return (size + STRIPE_ALIGNMENT - 1) / STRIPE_ALIGNMENT * STRIPE_ALIGNMENT;
+}
+
+StripeLocks::StripeLocks(void *table, std::size_t data_offset, std::size_t data_size, std::size_t stripe_size)
+    : words(reinterpret_cast<std::uint32_t *>(static_cast<std::uint8_t *>(table) + HEADER_SIZE)),  // NOLINT
+      stripe_size(stripe_size) {
+    if (stripe_size == 0 || stripe_size % STRIPE_ALIGNMENT != 0)
+        throw std::invalid_argument("the stripe size must be a multiple of " + std::to_string(STRIPE_ALIGNMENT));
+    if (reinterpret_cast<std::uintptr_t>(table) % alignof(std::uint64_t))  // NOLINT
+        throw std::invalid_argument("stripe lock table is not aligned");
+
+    stripes = (data_size + stripe_size - 1) / stripe_size;
+
+    auto *header = static_cast<std::uint8_t *>(table);
+
+    // keep the lock words if the table already describes this memory area (e.g. restart of the writer)
+    std::array<std::uint64_t, 4> current {};
+    std::uint32_t                version = 0;
+    std::memcpy(&version, header + OFFSET_VERSION, sizeof(version));
+    std::memcpy(current.data(), header + OFFSET_DATA_OFFSET, sizeof(current));
+    const std::array<std::uint64_t, 4> expected {data_offset, data_size, stripe_size, stripes};
+    if (std::memcmp(header, MAGIC.data(), MAGIC.size()) == 0 && version == VERSION && current == expected) return;
+
+    std::memset(header, 0, table_size(data_size, stripe_size));
+    std::memcpy(header + OFFSET_VERSION, &VERSION, sizeof(VERSION));
+    std::memcpy(header + OFFSET_DATA_OFFSET, expected.data(), sizeof(expected));
+
+    // the magic is written last: readers that see it also see a complete header
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header, MAGIC.data(), MAGIC.size());
+}
+
+bool StripeLocks::lock(std::size_t stripe, std::optional<std::chrono::nanoseconds> timeout) noexcept {
+    std::atomic_ref<std::uint32_t> word(words[stripe]);
+
+    // uncontended: no system call
+    auto value = UNLOCKED;
+    if (word.compare_exchange_strong(value, LOCKED, std::memory_order_acquire, std::memory_order_relaxed))
+        return true;
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout.value_or(std::chrono::nanoseconds::zero());
+    if (value != CONTENDED) value = word.exchange(CONTENDED, std::memory_order_acquire);
+    while (value != UNLOCKED) {
+        std::optional<std::chrono::nanoseconds> remaining;
+        if (timeout) {
+            remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining->count() <= 0) return false;
+        }
+        futex_wait(&words[stripe], CONTENDED, remaining);
+        value = word.exchange(CONTENDED, std::memory_order_acquire);
+    }
+    return true;
+}
+
+void StripeLocks::unlock(std::size_t stripe) noexcept {
+    std::atomic_ref<std::uint32_t> word(words[stripe]);
+    if (word.exchange(UNLOCKED, std::memory_order_release) == CONTENDED) futex_wake(&words[stripe], 1);
+}
+
+std::pair<std::size_t, std::size_t> StripeLocks::stripes_of(std::size_t offset, std::size_t size) const noexcept {
+    if (size == 0) return {offset / stripe_size, 0};
+    const auto first = offset / stripe_size;
+    const auto last  = (offset + size - 1) / stripe_size;
+    return {first, last - first + 1};
+}
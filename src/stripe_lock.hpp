@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+/**
+ * \brief table of locks, one per stripe of the memory area
+ * @details The memory area is divided into stripes of a fixed size. Every stripe is protected by its own lock, so
+ *          a reader only waits while the stripes it reads are written.
+ *
+ *          Layout of the lock table (all values in native endianness):
+ *
+ *     offset | size  | content
+ *     -------|-------|----------------------------------------------------------
+ *          0 |     8 | magic "SMRSTRIP"
+ *          8 |     4 | layout version (1)
+ *         12 |     4 | reserved
+ *         16 |     8 | offset of the memory area in the shared memory (start of stripe 0)
+ *         24 |     8 | size of the memory area in bytes
+ *         32 |     8 | stripe size in bytes (stripe i: [i * stripe size, (i + 1) * stripe size))
+ *         40 |     8 | number of stripes (N)
+ *         48 |    16 | reserved
+ *         64 | 4 * N | lock words (uint32)
+ *
+ *          Every lock word is a mutex on a shared futex (0: unlocked, 1: locked, 2: locked with waiters):
+ *              lock:   CAS 0 -> 1 (acquire). On failure: exchange 2 (acquire) until it returns 0,
+ *                      FUTEX_WAIT(word, 2) in between.
+ *              unlock: exchange 0 (release). If the previous value was 2: FUTEX_WAKE(word, 1).
+ *          Readers lock the stripes they read in ascending order and unlock them after the copy.
+ */
+class StripeLocks {
+public:
+    //* size of the header
+    static constexpr std::size_t HEADER_SIZE = 64;
+
+    //* layout version
+    static constexpr std::uint32_t VERSION = 1;
+
+    //* magic value at the start of the header
+    static constexpr std::array<char, 8> MAGIC {'S', 'M', 'R', 'S', 'T', 'R', 'I', 'P'};
+
+    //* stripe sizes are multiples of this size (cache line)
+    static constexpr std::size_t STRIPE_ALIGNMENT = 64;
+
+private:
+    std::uint32_t *words;
+    std::size_t    stripe_size;
+    std::size_t    stripes;
+
+public:
+    /**
+     * \brief create or attach to a lock table
+     * @details The header is (re)written if it does not describe the memory area. Otherwise, the lock words are
+     *          kept, so readers that hold a lock while the writer restarts are not disturbed.
+     * @param table address of the lock table (8 byte aligned)
+     * @param data_offset offset of the memory area in the shared memory
+     * @param data_size size of the memory area in bytes
+     * @param stripe_size stripe size in bytes (multiple of STRIPE_ALIGNMENT)
+     * @exception std::invalid_argument invalid stripe size or table not aligned
+     */
+    StripeLocks(void *table, std::size_t data_offset, std::size_t data_size, std::size_t stripe_size);
+
+    /**
+     * \brief get the size of the lock table
+     * @param data_size size of the memory area in bytes
+     * @param stripe_size stripe size in bytes (> 0)
+     * @return size of header and lock words in bytes (multiple of 64)
+     */
+    static std::size_t table_size(std::size_t data_size, std::size_t stripe_size) noexcept;
+
+    /**
+     * \brief lock a stripe
+     * @param stripe stripe index
+     * @param timeout maximum wait (std::nullopt: forever)
+     * @return false if the stripe was not locked within the timeout
+     */
+    bool lock(std::size_t stripe, std::optional<std::chrono::nanoseconds> timeout) noexcept;
+
+    /**
+     * \brief unlock a stripe that was locked by lock()
+     * @param stripe stripe index
+     */
+    void unlock(std::size_t stripe) noexcept;
+
+    /**
+     * \brief get the stripes that overlap with a byte range
+     * @param offset offset of the range (relative to the memory area)
+     * @param size size of the range in bytes
+     * @return first stripe and number of stripes
+     */
+    [[nodiscard]] std::pair<std::size_t, std::size_t> stripes_of(std::size_t offset, std::size_t size) const noexcept;
+
+    /**
+     * \brief get the stripe size
+     * @return stripe size in bytes
+     */
+    [[nodiscard]] std::size_t get_stripe_size() const noexcept { return stripe_size; }
+
+    /**
+     * \brief get the number of stripes
+     * @return number of stripes
+     */
+    [[nodiscard]] std::size_t get_stripes() const noexcept { return stripes; }
+};
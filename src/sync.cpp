@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "sync.hpp"
+
+#include "futex.hpp"
+#include "scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <ctime>
+#include <iostream>
+#include <stdexcept>
+
+//* upper bound of the adaptive timeout if no timeout is configured
+static constexpr std::chrono::nanoseconds ADAPTIVE_MAX_TIMEOUT = std::chrono::seconds(1);
+
+//* lower bound of the adaptive timeout
+static constexpr std::chrono::nanoseconds ADAPTIVE_MIN_TIMEOUT = std::chrono::microseconds(10);
+
+static constexpr long NS_PER_S = 1000000000;
+
+//* interval in which an unlimited wait checks for termination signals
+static constexpr timespec SIGNAL_POLL_INTERVAL {0, 100000000};
+
+/**
+ * \brief hint the CPU that the calling thread is busy waiting
+ */
+static inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+SemaphoreSync::SemaphoreSync(std::unique_ptr<cxxsemaphore::Semaphore> semaphore, const Policy &policy)
+    : semaphore(std::move(semaphore)), policy(policy),
+      adaptive_timeout(policy.timeout.count() ? policy.timeout : ADAPTIVE_MAX_TIMEOUT) {}
+
+std::optional<std::chrono::nanoseconds> SemaphoreSync::wait_limit() const noexcept {
+    switch (policy.strategy) {
+        case strategy_t::SKIP: return std::chrono::nanoseconds::zero();
+        case strategy_t::ADAPTIVE: return adaptive_timeout;
+        case strategy_t::DEADLINE:
+            if (deadline != std::chrono::steady_clock::time_point()) {
+                const auto remaining = deadline - std::chrono::steady_clock::now() - write_time;
+                return std::max(std::chrono::nanoseconds::zero(), remaining);
+            }
+            break;
+        case strategy_t::TIMEOUT:
+        case strategy_t::SPIN:
+        default: break;
+    }
+
+    if (policy.timeout.count() == 0) return std::nullopt;
+    return policy.timeout;
+}
+
+bool SemaphoreSync::acquire() {
+    const auto start = std::chrono::steady_clock::now();
+
+    // uncontended: no system call
+    bool acquired = semaphore->try_wait();
+
+    if (!acquired && policy.strategy != strategy_t::SKIP) {
+        auto limit = wait_limit();
+
+        if (policy.strategy == strategy_t::SPIN) {
+            static constexpr unsigned CLOCK_CHECK_INTERVAL = 64;
+            for (unsigned i = 1; !acquired; ++i) {
+                cpu_relax();
+                if (i % CLOCK_CHECK_INTERVAL == 0 && std::chrono::steady_clock::now() - start >= policy.spin) break;
+                acquired = semaphore->try_wait();
+            }
+            if (limit) *limit -= std::chrono::steady_clock::now() - start;
+        }
+
+        if (!acquired) {
+            if (!limit) {
+                // the termination signals are blocked (received by the scheduler): poll them
+                while (!(acquired = semaphore->wait(SIGNAL_POLL_INTERVAL))) {
+                    if (Scheduler::termination_pending()) {
+                        interrupted = true;
+                        break;
+                    }
+                }
+            } else if (limit->count() > 0) {
+                acquired = semaphore->wait(timespec {limit->count() / NS_PER_S, limit->count() % NS_PER_S});
+            }
+        }
+    }
+
+    if (acquired && policy.strategy == strategy_t::ADAPTIVE) {
+        static constexpr double MEAN_GAIN = 1.0 / 8;
+        static constexpr double DEV_GAIN  = 1.0 / 4;
+        static constexpr double DEV_MUL   = 4;
+
+        const auto wait = static_cast<double>((std::chrono::steady_clock::now() - start).count());
+        wait_dev += (std::abs(wait - wait_mean) - wait_dev) * DEV_GAIN;
+        wait_mean += (wait - wait_mean) * MEAN_GAIN;
+
+        const auto max     = policy.timeout.count() ? policy.timeout : ADAPTIVE_MAX_TIMEOUT;
+        const auto timeout = std::chrono::nanoseconds(static_cast<std::int64_t>(wait_mean + DEV_MUL * wait_dev));
+        adaptive_timeout   = std::clamp(timeout, std::min(ADAPTIVE_MIN_TIMEOUT, max), max);
+    }
+
+    return acquired;
+}
+
+void SemaphoreSync::on_failure() {
+    if (policy.strategy == strategy_t::TIMEOUT) {
+        std::cerr << " WARNING: Failed to acquire semaphore '" << semaphore->get_name() << "' within the timeout"
+                  << '\n';
+    } else {
+        ++skipped;
+        if (!failing) {
+            std::cerr << "WARNING: Semaphore '" << semaphore->get_name() << "' is not available. Frames are skipped."
+                      << '\n';
+        }
+    }
+    failing = true;
+
+    if (policy.strategy == strategy_t::ADAPTIVE) {
+        const auto max   = policy.timeout.count() ? policy.timeout : ADAPTIVE_MAX_TIMEOUT;
+        adaptive_timeout = std::min(adaptive_timeout * 2, max);
+    }
+
+    const bool was_failed = failed();
+    sem_error_counter += policy.error_cost;
+    if (!was_failed && failed()) std::cerr << "ERROR: acquiring semaphore failed to often. Terminating..." << '\n';
+}
+
+bool SemaphoreSync::begin() {
+    if (acquire()) {
+        if (sem_error_counter) --sem_error_counter;
+        failing = false;
+        if (policy.strategy == strategy_t::DEADLINE) write_start = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    if (interrupted) return false;
+    on_failure();
+
+    // previous behavior: the frame is written without the semaphore
+    return policy.strategy == strategy_t::TIMEOUT;
+}
+
+void SemaphoreSync::end() {
+    if (semaphore->is_acquired()) semaphore->post();
+    if (policy.strategy == strategy_t::DEADLINE) write_time = std::chrono::steady_clock::now() - write_start;
+}
+
+SemaphoreSync::strategy_t parse_semaphore_strategy(const std::string &name) {
+    if (name == "timeout") return SemaphoreSync::strategy_t::TIMEOUT;
+    if (name == "spin") return SemaphoreSync::strategy_t::SPIN;
+    if (name == "deadline") return SemaphoreSync::strategy_t::DEADLINE;
+    if (name == "skip") return SemaphoreSync::strategy_t::SKIP;
+    if (name == "adaptive") return SemaphoreSync::strategy_t::ADAPTIVE;
+    throw std::invalid_argument("invalid semaphore strategy '" + name + '\'');
+}
+
+SeqlockSync::SeqlockSync(void *header) : sequence(static_cast<std::uint64_t *>(header)) {
+    if (reinterpret_cast<std::uintptr_t>(header) % std::atomic_ref<std::uint64_t>::required_alignment)  // NOLINT
+        throw std::invalid_argument("seqlock header is not aligned");
+}
+
+bool SeqlockSync::begin() {
+    std::atomic_ref<std::uint64_t> seq(*sequence);
+    const auto                     value = seq.load(std::memory_order_relaxed);
+    // an odd value is left by a writer that was terminated during a frame --> continue with the next odd value
+    seq.store(value + (value & 1U ? 2U : 1U), std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+}
+
+void SeqlockSync::end() {
+    std::atomic_ref<std::uint64_t> seq(*sequence);
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+FrameNotify::FrameNotify(void *header) : generation(static_cast<std::uint32_t *>(header)) {
+    if (reinterpret_cast<std::uintptr_t>(header) % std::atomic_ref<std::uint32_t>::required_alignment)  // NOLINT
+        throw std::invalid_argument("notification word is not aligned");
+}
+
+void FrameNotify::notify() noexcept {
+    std::atomic_ref<std::uint32_t> gen(*generation);
+    gen.fetch_add(1, std::memory_order_release);
+    futex_wake(generation, INT_MAX);
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cxxsemaphore.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+/**
+ * \brief synchronization of the shared memory writes with the readers
+ * @details begin() is called before a frame is written to the shared memory, end() afterwards.
+ */
+class FrameSync {
+public:
+    virtual ~FrameSync() = default;
+
+    /**
+     * \brief called before a frame is written
+     * @return false if the frame has to be skipped (end() must not be called)
+     */
+    virtual bool begin() = 0;
+
+    /**
+     * \brief called after a frame was written
+     */
+    virtual void end() = 0;
+
+    /**
+     * \brief check if the application should terminate because of synchronization errors
+     * @return true if the application should terminate
+     */
+    [[nodiscard]] virtual bool failed() const noexcept { return false; }
+
+    /**
+     * \brief get the current error counter of the synchronization
+     * @return error counter (0: no errors)
+     */
+    [[nodiscard]] virtual std::size_t get_error_counter() const noexcept { return 0; }
+};
+
+/**
+ * \brief synchronization via named semaphore
+ * @details Every failed acquisition increases an error counter by Policy::error_cost, every successful acquisition
+ *          decreases it by one. If the counter reaches Policy::error_limit, failed() returns true.
+ */
+class SemaphoreSync final : public FrameSync {
+public:
+    static constexpr std::size_t MAX_SEM_ERROR = 1000;
+    static constexpr std::size_t SEM_ERROR_INC = 100;
+
+    //* acquisition strategy
+    enum class strategy_t {
+        TIMEOUT,   //*< wait up to the timeout, write the frame anyway after a timeout (previous behavior)
+        SPIN,      //*< try to acquire for the spin time, then wait up to the timeout. Skip the frame on timeout.
+        DEADLINE,  //*< wait until the deadline minus the duration of the last write (see set_deadline). Skip then.
+        SKIP,      //*< try once, skip the frame if the semaphore is held
+        ADAPTIVE,  //*< wait up to mean + 4 * deviation of the observed waits, doubled on timeout. Skip on timeout.
+    };
+
+    //* acquisition policy
+    struct Policy {
+        strategy_t               strategy = strategy_t::TIMEOUT;
+        std::chrono::nanoseconds timeout {0};  //*< maximum wait (0: wait forever; ADAPTIVE: upper bound)
+        std::chrono::nanoseconds spin {std::chrono::microseconds(50)};  //*< busy wait of SPIN (NOLINT)
+        std::size_t              error_limit = MAX_SEM_ERROR;           //*< error counter limit (0: no limit)
+        std::size_t              error_cost  = SEM_ERROR_INC;           //*< error counter increment per failure
+    };
+
+private:
+    std::unique_ptr<cxxsemaphore::Semaphore> semaphore;
+    Policy                                   policy;
+    std::size_t                              sem_error_counter = 0;
+    std::uint64_t                            skipped           = 0;
+    bool                                     failing           = false;
+    bool                                     interrupted       = false;  //*< termination signal while waiting
+
+    // DEADLINE
+    std::chrono::steady_clock::time_point deadline;
+    std::chrono::steady_clock::time_point write_start;
+    std::chrono::nanoseconds              write_time {0};
+
+    // ADAPTIVE (exponentially weighted mean and mean deviation of the waits, as for the TCP retransmission timeout)
+    double                   wait_mean = 0;
+    double                   wait_dev  = 0;
+    std::chrono::nanoseconds adaptive_timeout;
+
+    /**
+     * \brief get the maximum wait of the current acquisition
+     * @return maximum wait (std::nullopt: forever)
+     */
+    [[nodiscard]] std::optional<std::chrono::nanoseconds> wait_limit() const noexcept;
+
+    /**
+     * \brief acquire the semaphore according to the strategy
+     * @return true if the semaphore was acquired
+     */
+    bool acquire();
+
+    /**
+     * \brief handle a failed acquisition
+     */
+    void on_failure();
+
+public:
+    /**
+     * \brief create semaphore synchronization
+     * @param semaphore semaphore
+     * @param policy acquisition policy
+     */
+    SemaphoreSync(std::unique_ptr<cxxsemaphore::Semaphore> semaphore, const Policy &policy);
+
+    bool begin() override;
+    void end() override;
+
+    /**
+     * \brief replace the semaphore (e.g. after it was recreated by its owner)
+     * @details Must not be called between begin() and end().
+     * @param new_semaphore new semaphore
+     */
+    void set_semaphore(std::unique_ptr<cxxsemaphore::Semaphore> new_semaphore) noexcept {
+        semaphore = std::move(new_semaphore);
+    }
+
+    /**
+     * \brief set the deadline of the next acquisition (strategy DEADLINE)
+     * @param time deadline (usually the next tick)
+     */
+    void set_deadline(std::chrono::steady_clock::time_point time) noexcept { deadline = time; }
+
+    /**
+     * \brief get the number of skipped frames
+     * @return number of calls of begin() that returned false
+     */
+    [[nodiscard]] std::uint64_t get_skipped() const noexcept { return skipped; }
+
+    /**
+     * \brief check if the application has to terminate
+     * @return true if the error limit was reached or an unlimited wait was interrupted by SIGINT or SIGTERM
+     */
+    [[nodiscard]] bool failed() const noexcept override {
+        return interrupted || (policy.error_limit && sem_error_counter >= policy.error_limit);
+    }
+
+    [[nodiscard]] std::size_t get_error_counter() const noexcept override { return sem_error_counter; }
+};
+
+/**
+ * \brief parse a semaphore acquisition strategy
+ * @param name strategy (timeout, spin, deadline, skip or adaptive)
+ * @return strategy
+ * @exception std::invalid_argument unknown strategy
+ */
+SemaphoreSync::strategy_t parse_semaphore_strategy(const std::string &name);
+
+/**
+ * \brief lock free synchronization via sequence counter (seqlock)
+ * @details The sequence counter (64 bit, native endianness) is incremented before and after every frame.
+ *          An odd value indicates that a frame is currently written.
+ *
+ *          Readers have to:
+ *              1. read the counter (acquire), retry if it is odd
+ *              2. copy the data
+ *              3. read the counter again (acquire fence before), retry if it changed
+ */
+class SeqlockSync final : public FrameSync {
+public:
+    //* size of the header that contains the sequence counter (one cache line)
+    static constexpr std::size_t HEADER_SIZE = 64;
+
+private:
+    std::uint64_t *sequence;
+
+public:
+    /**
+     * \brief create seqlock synchronization
+     * @param header pointer to the sequence counter (must be 8 byte aligned)
+     * @exception std::invalid_argument header not aligned
+     */
+    explicit SeqlockSync(void *header);
+
+    bool begin() override;
+    void end() override;
+};
+
+/**
+ * \brief notification of the readers after every frame via shared futex
+ * @details A 32 bit generation word (native endianness) is incremented (release) after every written frame and all
+ *          threads that wait on the word are woken (FUTEX_WAKE on the shared, non private futex).
+ *          The notification is independent of the synchronization (e.g. it is done after the semaphore is posted).
+ *
+ *          Readers have to:
+ *              1. load the generation word (acquire)
+ *              2. read the data
+ *              3. FUTEX_WAIT(word, loaded value) to sleep until the next frame, continue with 1.
+ *
+ *          The word wraps around. The existing value is kept when the writer starts.
+ */
+class FrameNotify {
+public:
+    //* size of the header that contains the generation word (one cache line)
+    static constexpr std::size_t HEADER_SIZE = 64;
+
+private:
+    std::uint32_t *generation;
+
+public:
+    /**
+     * \brief create futex notification
+     * @param header pointer to the generation word (must be 4 byte aligned)
+     * @exception std::invalid_argument header not aligned
+     */
+    explicit FrameNotify(void *header);
+
+    /**
+     * \brief increment the generation word and wake all waiting readers
+     */
+    void notify() noexcept;
+};
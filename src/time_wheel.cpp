@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "time_wheel.hpp"
+
+#include <stdexcept>
+
+TimeWheel::TimeWheel(std::size_t slots) : slots(slots) {
+    if (slots == 0) throw std::invalid_argument("number of slots must not be 0");
+}
+
+void TimeWheel::add(std::size_t id, std::uint64_t divider) {
+    if (divider == 0) throw std::invalid_argument("divider must not be 0");
+    slots[tick % slots.size()].push_back({id, divider, tick});
+}
+
+void TimeWheel::advance(std::vector<std::size_t> &due) {
+    due.clear();
+
+    auto &slot = slots[tick % slots.size()];
+
+    // timers of later revolutions stay in the slot
+    std::size_t keep = 0;
+    for (const auto &timer : slot) {
+        if (timer.due == tick) {
+            due.push_back(timer.id);
+            rescheduled.push_back({timer.id, timer.divider, tick + timer.divider});
+        } else {
+            slot[keep++] = timer;
+        }
+    }
+    slot.resize(keep);
+
+    for (const auto &timer : rescheduled)
+        slots[timer.due % slots.size()].push_back(timer);
+    rescheduled.clear();
+
+    ++tick;
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \brief hashed timing wheel for periodic timers with a common tick
+ * @details Every timer is due every divider ticks, starting with tick 0.
+ *          A timer is stored in the slot of its next due tick (modulo the number of slots),
+ *          so advance() only visits the timers of one slot.
+ */
+class TimeWheel {
+public:
+    //* default number of slots
+    static constexpr std::size_t DEFAULT_SLOTS = 64;
+
+private:
+    struct Timer {
+        std::size_t   id;
+        std::uint64_t divider;
+        std::uint64_t due;
+    };
+
+    std::vector<std::vector<Timer>> slots;
+    std::vector<Timer>              rescheduled;
+    std::uint64_t                   tick = 0;
+
+public:
+    /**
+     * \brief create timing wheel
+     * @param slots number of slots (> 0)
+     * @exception std::invalid_argument slots == 0
+     */
+    explicit TimeWheel(std::size_t slots = DEFAULT_SLOTS);
+
+    /**
+     * \brief add a periodic timer
+     * @param id identifier of the timer (returned by advance)
+     * @param divider the timer is due every divider ticks (> 0)
+     * @exception std::invalid_argument divider == 0
+     */
+    void add(std::size_t id, std::uint64_t divider);
+
+    /**
+     * \brief advance to the next tick
+     * @param due the identifiers of all timers that are due in this tick are stored here
+     */
+    void advance(std::vector<std::size_t> &due);
+};
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "update_window.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+UpdateWindow::UpdateWindow(std::size_t size, double fraction, mode_t mode, std::uint64_t seed)
+    : size(size), blocks((size + BLOCK_SIZE - 1) / BLOCK_SIZE), mode(mode), rng(seed) {
+    if (size == 0) throw std::invalid_argument("size must not be 0");
+    if (!(fraction > 0 && fraction <= 1)) throw std::invalid_argument("fraction must be in (0, 1]");
+
+    blocks_per_update = std::clamp<std::size_t>(
+            static_cast<std::size_t>(std::ceil(static_cast<double>(blocks) * fraction)), 1, blocks);
+}
+
+void UpdateWindow::add_block(std::size_t block) {
+    const auto offset = block * BLOCK_SIZE;
+    const auto length = std::min(BLOCK_SIZE, size - offset);
+
+    // merge adjacent blocks
+    if (!ranges.empty() && ranges.back().first + ranges.back().second == offset) ranges.back().second += length;
+    else ranges.emplace_back(offset, length);
+
+    update_size += length;
+}
+
+void UpdateWindow::select_sliding() {
+    const auto first = cursor;
+    const auto last  = std::min(blocks, first + blocks_per_update);
+
+    for (auto block = first; block < last; ++block)
+        add_block(block);
+
+    // wrap around
+    for (std::size_t block = 0; block < blocks_per_update - (last - first); ++block)
+        add_block(block);
+
+    cursor = (cursor + blocks_per_update) % blocks;
+}
+
+void UpdateWindow::select_random() {
+    // one random block per stratum --> distinct, sorted and evenly distributed blocks
+    for (std::size_t i = 0; i < blocks_per_update; ++i) {
+        const auto first = blocks * i / blocks_per_update;
+        const auto last  = blocks * (i + 1) / blocks_per_update;
+        add_block(first + rng() % (last - first));
+    }
+}
+
+void UpdateWindow::update(void *data, const LaneMask &mask, ParallelFill &filler) {
+    ranges.clear();
+    update_size = 0;
+
+    if (mode == mode_t::SLIDING) select_sliding();
+    else select_random();
+
+    filler.fill_ranges(data, ranges, mask);
+}
+
+UpdateWindow::mode_t parse_window_mode(const std::string &str) {
+    if (str == "sliding") return UpdateWindow::mode_t::SLIDING;
+    if (str == "random") return UpdateWindow::mode_t::RANDOM;
+    throw std::invalid_argument("invalid window mode '" + str + '\'');
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "engine.hpp"
+#include "fill.hpp"
+#include "parallel_fill.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \brief partial update of a memory area
+ * @details The memory area is split into cache line sized blocks (relative to the start of the memory area).
+ *          Every update rewrites only a fraction of the blocks:
+ *              - SLIDING: a contiguous window that moves forward by its own size with every update (wraps around)
+ *              - RANDOM: one randomly selected block out of every 1 / fraction blocks
+ */
+class UpdateWindow {
+public:
+    //* size of one block
+    static constexpr std::size_t BLOCK_SIZE = ParallelFill::CACHE_LINE_SIZE;
+
+    //* selection of the blocks
+    enum class mode_t {
+        SLIDING,  //*< sliding window
+        RANDOM    //*< random blocks
+    };
+
+private:
+    std::size_t                        size;
+    std::size_t                        blocks;
+    std::size_t                        blocks_per_update;
+    mode_t                             mode;
+    std::size_t                        cursor = 0;
+    SplitMix64                         rng;
+    std::vector<ParallelFill::range_t> ranges;
+    std::size_t                        update_size = 0;
+
+    void select_sliding();
+    void select_random();
+    void add_block(std::size_t block);
+
+public:
+    /**
+     * \brief create partial update
+     * @param size size of the memory area in bytes
+     * @param fraction fraction of the blocks that is updated every time (0 < fraction <= 1)
+     * @param mode block selection
+     * @param seed seed for the random block selection
+     * @exception std::invalid_argument invalid fraction or size == 0
+     */
+    UpdateWindow(std::size_t size, double fraction, mode_t mode, std::uint64_t seed);
+
+    /**
+     * \brief rewrite the next blocks
+     * @param data pointer to memory area
+     * @param mask bitmask that is applied to the generated random values
+     * @param filler (multi threaded) random data generator
+     */
+    void update(void *data, const LaneMask &mask, ParallelFill &filler);
+
+    /**
+     * \brief get the number of bytes that were written by the last update
+     * @return number of bytes
+     */
+    [[nodiscard]] std::size_t get_update_size() const noexcept { return update_size; }
+};
+
+/**
+ * \brief parse a block selection mode (sliding or random)
+ * @param str block selection mode
+ * @return block selection mode
+ * @exception std::invalid_argument invalid mode
+ */
+UpdateWindow::mode_t parse_window_mode(const std::string &str);
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "worker_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdexcept>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+
+/**
+ * \brief pin a thread to a cpu
+ * @param thread native thread handle
+ * @param cpu cpu index
+ */
+static void pin_native_thread(pthread_t thread, int cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<std::size_t>(cpu), &set);  // NOLINT
+    const int tmp = pthread_setaffinity_np(thread, sizeof(set), &set);
+    if (tmp != 0)
+        throw std::system_error(tmp, std::generic_category(), "failed to pin thread to cpu " + std::to_string(cpu));
+}
+
+void pin_thread(int cpu) {
+    pin_native_thread(pthread_self(), cpu);
+}
+
+WorkerPool::WorkerPool(std::size_t workers, const std::vector<int> &cpus) {
+    if (workers == 0) throw std::invalid_argument("number of workers must not be 0");
+
+    if (!cpus.empty()) pin_thread(cpus[0]);
+
+    threads.reserve(workers - 1);
+    try {
+        for (std::size_t i = 1; i < workers; ++i) {
+            threads.emplace_back(&WorkerPool::worker, this, i);
+            if (!cpus.empty()) pin_native_thread(threads.back().native_handle(), cpus[i % cpus.size()]);
+        }
+    } catch (...) {
+        stop = true;
+        ++generation;
+        generation.notify_all();
+        for (auto &thread : threads)
+            thread.join();
+        throw;
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    stop = true;
+    ++generation;
+    generation.notify_all();
+    for (auto &thread : threads)
+        thread.join();
+}
+
+void WorkerPool::worker(std::size_t index) {
+    std::uint32_t last = 0;
+
+    while (true) {
+        generation.wait(last);
+        if (stop) break;
+        last = generation.load();
+
+        (*job)(index);
+
+        if (pending.fetch_sub(1) == 1) pending.notify_one();
+    }
+}
+
+void WorkerPool::run(const job_t &job_function) {
+    if (!threads.empty()) {
+        job     = &job_function;
+        pending = threads.size();
+        ++generation;
+        generation.notify_all();
+    }
+
+    job_function(0);
+
+    for (auto p = pending.load(); p != 0; p = pending.load())
+        pending.wait(p);
+}
+
+std::vector<int> parse_cpu_list(const std::string &cpu_list) {
+    std::vector<int> cpus;
+
+    auto parse_int = [&](const std::string &str) {
+        std::size_t idx = 0;
+        int         value;
+        try {
+            value = std::stoi(str, &idx, 10);  // NOLINT
+        } catch (const std::exception &) { throw std::invalid_argument("invalid cpu list '" + cpu_list + '\''); }
+        if (idx != str.size() || value < 0 || value >= CPU_SETSIZE)
+            throw std::invalid_argument("invalid cpu list '" + cpu_list + '\'');
+        return value;
+    };
+
+    std::size_t pos = 0;
+    while (pos <= cpu_list.size()) {
+        const auto end   = std::min(cpu_list.find(',', pos), cpu_list.size());
+        const auto item  = cpu_list.substr(pos, end - pos);
+        const auto range = item.find('-');
+
+        if (range == std::string::npos) {
+            cpus.push_back(parse_int(item));
+        } else {
+            const auto first = parse_int(item.substr(0, range));
+            const auto last  = parse_int(item.substr(range + 1));
+            if (last < first) throw std::invalid_argument("invalid cpu list '" + cpu_list + '\'');
+            for (int i = first; i <= last; ++i)
+                cpus.push_back(i);
+        }
+
+        pos = end + 1;
+    }
+
+    return cpus;
+}
+
+int current_numa_node() noexcept {
+    unsigned cpu  = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == -1) return -1;  // NOLINT
+    return static_cast<int>(node);
+}
+
+bool bind_numa_node(void *data, std::size_t size, int node) noexcept {
+    static constexpr std::size_t MAX_NODES = 1024;
+    static constexpr std::size_t BITS      = sizeof(unsigned long) * CHAR_BIT;
+
+    if (node < 0 || static_cast<std::size_t>(node) >= MAX_NODES) return false;
+
+    const auto page_size = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin     = (reinterpret_cast<std::uintptr_t>(data) + page_size - 1) / page_size * page_size;  // NOLINT
+    const auto end       = (reinterpret_cast<std::uintptr_t>(data) + size) / page_size * page_size;            // NOLINT
+    if (end <= begin) return true;
+
+    std::array<unsigned long, MAX_NODES / BITS> node_mask {};
+    const auto                                  n = static_cast<std::size_t>(node);
+    node_mask[n / BITS] |= 1UL << (n % BITS);  // NOLINT
+
+    return syscall(SYS_mbind,  // NOLINT
+                   begin,
+                   end - begin,
+                   MPOL_PREFERRED,
+                   node_mask.data(),
+                   MAX_NODES + 1,
+                   MPOL_MF_MOVE) == 0;
+}
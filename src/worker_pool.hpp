@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief pool of long living worker threads
+ * @details The threads are created once and woken by a futex (std::atomic::wait/notify) for every job.
+ *          The calling thread is used as worker 0.
+ */
+class WorkerPool {
+public:
+    //* job function (argument: worker index)
+    using job_t = std::function<void(std::size_t)>;
+
+private:
+    std::vector<std::thread>   threads;
+    const job_t               *job = nullptr;
+    std::atomic<std::uint32_t> generation {0};
+    std::atomic<std::size_t>   pending {0};
+    std::atomic<bool>          stop {false};
+
+    void worker(std::size_t index);
+
+public:
+    /**
+     * \brief create worker pool
+     * @param workers number of workers (including the calling thread)
+     * @param cpus cpus the workers are pinned to (worker i --> cpus[i % cpus.size()]). Empty: no pinning.
+     * @exception std::system_error failed to pin the calling thread
+     */
+    explicit WorkerPool(std::size_t workers, const std::vector<int> &cpus = {});
+
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &)            = delete;
+    WorkerPool(WorkerPool &&)                 = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+    WorkerPool &operator=(WorkerPool &&)      = delete;
+
+    /**
+     * \brief execute job on all workers and wait for completion
+     * @param job job function
+     */
+    void run(const job_t &job);
+
+    /**
+     * \brief get the number of workers (including the calling thread)
+     * @return number of workers
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return threads.size() + 1; }
+};
+
+/**
+ * \brief parse a cpu list (e.g. "0-3,8,10-11")
+ * @param cpu_list cpu list
+ * @return list of cpus
+ * @exception std::invalid_argument invalid cpu list
+ */
+std::vector<int> parse_cpu_list(const std::string &cpu_list);
+
+/**
+ * \brief pin the calling thread to a cpu
+ * @param cpu cpu index
+ * @exception std::system_error failed to set affinity
+ */
+void pin_thread(int cpu);
+
+/**
+ * \brief get the NUMA node of the cpu the calling thread is currently running on
+ * @return NUMA node or -1 if unknown
+ */
+int current_numa_node() noexcept;
+
+/**
+ * \brief set the preferred NUMA node for a memory area and migrate already allocated pages
+ * @details Only the pages that are completely inside of the memory area are affected.
+ * @param data start of the memory area
+ * @param size size of the memory area in bytes
+ * @param node NUMA node
+ * @return true on success
+ */
+bool bind_numa_node(void *data, std::size_t size, int node) noexcept;
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "buffer.hpp"
+#include "engine.hpp"
+#include "fill.hpp"
+#include "parallel_fill.hpp"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+//* size of the filled memory area (larger than the last level cache of most hosts)
+static constexpr std::size_t SIZE = 64 * 1024 * 1024;
+
+//* element bitmask of the masked kernels
+static constexpr std::uint64_t MASK = 0x0f0f0f0f0f0f0f0f;
+
+/**
+ * \brief measure ParallelFill::fill for one combination of engine, alignment, mask, thread count and store type
+ */
+static void bench_fill(benchmark::State     &state,
+                       const std::string    &engine,
+                       std::size_t           alignment,
+                       bool                  masked,
+                       std::size_t           threads,
+                       ParallelFill::store_t store) {
+    static PrivateBuffer buffer(SIZE);
+
+    ParallelFill filler(engine, threads, 1);
+    filler.set_store(store);
+    const LaneMask mask(masked ? MASK : ~std::uint64_t {0}, alignment);
+
+    // warm up (page faults, caches)
+    filler.fill(buffer.get_addr(), SIZE, mask);
+
+    for (auto _ : state) {
+        filler.fill(buffer.get_addr(), SIZE, mask);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * SIZE));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * (SIZE / alignment)));
+}
+
+/**
+ * \brief measure ParallelFill::copy (prebuffer and replay)
+ */
+static void bench_copy(benchmark::State &state, std::size_t threads, ParallelFill::store_t store) {
+    static PrivateBuffer src(SIZE);
+    static PrivateBuffer dst(SIZE);
+
+    ParallelFill filler("wyrand", threads, 1);
+    filler.set_store(store);
+    filler.fill(src.get_addr(), SIZE, LaneMask(~std::uint64_t {0}, 1));
+    filler.copy(dst.get_addr(), src.get_addr(), SIZE);
+
+    for (auto _ : state) {
+        filler.copy(dst.get_addr(), src.get_addr(), SIZE);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * SIZE));
+}
+
+/**
+ * \brief thread counts: powers of two up to the number of cpus
+ */
+static std::vector<std::size_t> thread_counts() {
+    const std::size_t        max_threads = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<std::size_t> threads;
+    for (std::size_t i = 1; i < max_threads; i *= 2)
+        threads.push_back(i);
+    threads.push_back(max_threads);
+    return threads;
+}
+
+int main(int argc, char **argv) {
+    const std::vector<std::pair<ParallelFill::store_t, const char *>> stores {
+            {ParallelFill::store_t::CACHED, "cached"}, {ParallelFill::store_t::STREAM, "stream"}};
+
+    // e.g. fill/wyrand/align:8/mask:full/threads:4/store:stream (use --benchmark_filter to select)
+    for (const auto &engine : engine_names()) {
+        for (const std::size_t alignment : {1, 2, 4, 8}) {
+            for (const bool masked : {false, true}) {
+                for (const auto threads : thread_counts()) {
+                    for (const auto &[store, store_name] : stores) {
+                        const auto name = "fill/" + engine + "/align:" + std::to_string(alignment) +
+                                          "/mask:" + (masked ? "masked" : "full") +
+                                          "/threads:" + std::to_string(threads) + "/store:" + store_name;
+                        benchmark::RegisterBenchmark(
+                                name.c_str(), bench_fill, engine, alignment, masked, threads, store)
+                                ->Unit(benchmark::kMillisecond)
+                                ->UseRealTime();
+                    }
+                }
+            }
+        }
+    }
+
+    for (const auto threads : thread_counts()) {
+        for (const auto &[store, store_name] : stores) {
+            const auto name = "copy/threads:" + std::to_string(threads) + "/store:" + store_name;
+            benchmark::RegisterBenchmark(name.c_str(), bench_copy, threads, store)
+                    ->Unit(benchmark::kMillisecond)
+                    ->UseRealTime();
+        }
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
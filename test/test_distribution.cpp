@@ -0,0 +1,300 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "distribution.hpp"
+#include "engine.hpp"
+#include "fill.hpp"
+#include "parallel_fill.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//* number of elements of the statistical tests
+static constexpr std::size_t SAMPLES = 1 << 18;
+
+//* tolerance of the statistical tests in standard errors
+static constexpr double SIGMAS = 6.0;
+
+/**
+ * \brief generate elements of a distribution (single threaded)
+ */
+template <typename T>
+static std::vector<T> sample(const std::string &spec,
+                             const std::string &type,
+                             const std::string &engine_name,
+                             std::size_t        count = SAMPLES) {
+    const auto distribution = make_distribution(spec, type);
+    const auto engine       = make_engine(engine_name, 42);  // NOLINT
+    EXPECT_EQ(distribution->element_size(), sizeof(T));
+
+    std::vector<T> values(count);
+    distribution->generate(values.data(), values.size(), *engine);
+    return values;
+}
+
+/**
+ * \brief mean and variance of the samples
+ */
+template <typename T>
+static std::pair<double, double> moments(const std::vector<T> &values) {
+    double sum = 0.0;
+    for (const auto value : values)
+        sum += static_cast<double>(value);
+    const double mean = sum / static_cast<double>(values.size());
+
+    double squares = 0.0;
+    for (const auto value : values) {
+        const auto diff = static_cast<double>(value) - mean;
+        squares += diff * diff;
+    }
+    return {mean, squares / static_cast<double>(values.size() - 1)};
+}
+
+/**
+ * \brief chi-squared statistic of observed counts
+ */
+static double chi2(const std::map<std::int64_t, std::size_t> &counts, const std::map<std::int64_t, double> &expected) {
+    double result = 0.0;
+    for (const auto &[value, count] : expected) {
+        const auto observed = counts.count(value) ? static_cast<double>(counts.at(value)) : 0.0;
+        const auto diff     = observed - count;
+        result += diff * diff / count;
+    }
+    return result;
+}
+
+// ---------------------------------------- uniform (Lemire's bounded integers, floats) --------------------------------
+
+class DistributionTypeTest : public ::testing::TestWithParam<std::string> {};
+
+/**
+ * \brief check that uniform:MIN,MAX stays in its bounds and hits every integer value equally often
+ */
+template <typename T>
+static void check_uniform(const std::string &type) {
+    if constexpr (std::is_floating_point_v<T>) {
+        static constexpr double MIN = -2.5;
+        static constexpr double MAX = 4.0;
+
+        const auto values = sample<T>("uniform:-2.5,4", type, "xoshiro256ss");
+        for (const auto value : values) {
+            ASSERT_GE(value, static_cast<T>(MIN));
+            ASSERT_LT(value, static_cast<T>(MAX));
+        }
+
+        // uniform distribution: variance width^2 / 12
+        const auto [mean, variance] = moments(values);
+        const auto width            = MAX - MIN;
+        const auto stddev           = width / std::sqrt(12.0);  // NOLINT
+        EXPECT_NEAR(mean, (MIN + MAX) / 2, SIGMAS * stddev / std::sqrt(static_cast<double>(SAMPLES)));
+        EXPECT_NEAR(variance, width * width / 12.0, 0.01 * width * width);  // NOLINT
+    } else {
+        // 9 values, the range does not divide 2^bits: the rejection of Lemire's method is required
+        const std::int64_t min    = std::is_signed_v<T> ? -3 : 3;
+        const std::int64_t max    = min + 8;  // NOLINT
+        const auto         spec   = "uniform:" + std::to_string(min) + ',' + std::to_string(max);
+        const auto         values = sample<T>(spec, type, "xoshiro256ss");
+
+        std::map<std::int64_t, std::size_t> counts;
+        for (const auto value : values) {
+            ASSERT_GE(static_cast<std::int64_t>(value), min);
+            ASSERT_LE(static_cast<std::int64_t>(value), max);
+            ++counts[static_cast<std::int64_t>(value)];
+        }
+
+        // 8 degrees of freedom, p < 1e-8
+        std::map<std::int64_t, double> expected;
+        for (auto value = min; value <= max; ++value)
+            expected[value] = static_cast<double>(SAMPLES) / 9.0;  // NOLINT
+        EXPECT_LT(chi2(counts, expected), 50.0);                   // NOLINT
+    }
+}
+
+TEST_P(DistributionTypeTest, UniformBounds) {
+    const auto &type = GetParam();
+    if (type == "u8") check_uniform<std::uint8_t>(type);
+    else if (type == "i8") check_uniform<std::int8_t>(type);
+    else if (type == "u16") check_uniform<std::uint16_t>(type);
+    else if (type == "i16") check_uniform<std::int16_t>(type);
+    else if (type == "u32") check_uniform<std::uint32_t>(type);
+    else if (type == "i32") check_uniform<std::int32_t>(type);
+    else if (type == "u64") check_uniform<std::uint64_t>(type);
+    else if (type == "i64") check_uniform<std::int64_t>(type);
+    else if (type == "f32") check_uniform<float>(type);
+    else check_uniform<double>(type);
+}
+
+/**
+ * the element size is the size of the element type
+ */
+TEST_P(DistributionTypeTest, ElementSize) {
+    EXPECT_EQ(make_distribution("uniform:1,2", GetParam())->element_size(), element_type_size(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(AllTypes,
+                         DistributionTypeTest,
+                         ::testing::ValuesIn(element_type_names()),
+                         [](const ::testing::TestParamInfo<std::string> &param_info) { return param_info.param; });
+
+/**
+ * wide ranges, a single value and the full 64 bit range
+ */
+TEST(Distribution, UniformRanges) {
+    for (const auto value : sample<std::uint32_t>("uniform:7,7", "u32", "wyrand", 1000))  // NOLINT
+        ASSERT_EQ(value, 7U);
+
+    // wide range that is not a power of two
+    static constexpr double MAX    = 1173741823;
+    const auto              values = sample<std::uint32_t>("uniform:0,1173741823", "u32", "wyrand");
+    for (const auto value : values)
+        ASSERT_LE(value, static_cast<std::uint32_t>(MAX));
+    const auto [mean, variance] = moments(values);
+    EXPECT_NEAR(mean, MAX / 2, SIGMAS * MAX / std::sqrt(12.0 * SAMPLES));  // NOLINT
+
+    // full range: every bit is set with probability 1/2
+    const auto full = sample<std::uint64_t>("uniform:0,18446744073709551615", "u64", "wyrand");
+    std::size_t ones = 0;
+    for (const auto value : full)
+        ones += static_cast<std::size_t>(__builtin_popcountll(value));
+    EXPECT_NEAR(static_cast<double>(ones) / (64.0 * SAMPLES), 0.5, 0.001);  // NOLINT
+}
+
+TEST(Distribution, InvalidSpecification) {
+    for (const auto *spec : {"uniform:5,1", "uniform:1", "normal:0,0", "normal:0,-1", "exponential:0",
+                             "discrete:1", "discrete:1=0", "unknown:1", "uniform", "uniform:1,x"})
+        EXPECT_THROW(static_cast<void>(make_distribution(spec, "i32")), std::invalid_argument) << spec;
+
+    EXPECT_THROW(static_cast<void>(make_distribution("uniform:0,256", "u8")), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(make_distribution("uniform:-1,1", "u16")), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(make_distribution("uniform:0,1", "f16")), std::invalid_argument);
+}
+
+// ---------------------------------------- statistics (ziggurat, alias table) -----------------------------------------
+
+class DistributionEngineTest : public ::testing::TestWithParam<std::string> {};
+
+/**
+ * normal:10,2 (ziggurat): mean 10, variance 4
+ */
+TEST_P(DistributionEngineTest, NormalMoments) {
+    static constexpr double MEAN   = 10.0;
+    static constexpr double STDDEV = 2.0;
+
+    // standard errors of the mean and the variance
+    const double mean_error     = STDDEV / std::sqrt(static_cast<double>(SAMPLES));
+    const double variance_error = STDDEV * STDDEV * std::sqrt(2.0 / static_cast<double>(SAMPLES));
+
+    const auto [mean64, variance64] = moments(sample<double>("normal:10,2", "f64", GetParam()));
+    EXPECT_NEAR(mean64, MEAN, SIGMAS * mean_error);
+    EXPECT_NEAR(variance64, STDDEV * STDDEV, SIGMAS * variance_error);
+
+    const auto [mean32, variance32] = moments(sample<float>("normal:10,2", "f32", GetParam()));
+    EXPECT_NEAR(mean32, MEAN, SIGMAS * mean_error);
+    EXPECT_NEAR(variance32, STDDEV * STDDEV, SIGMAS * variance_error);
+
+    // rounded to integers: variance + 1/12
+    const auto [mean_int, variance_int] = moments(sample<std::int16_t>("normal:10,2", "i16", GetParam()));
+    EXPECT_NEAR(mean_int, MEAN, SIGMAS * mean_error);
+    EXPECT_NEAR(variance_int, STDDEV * STDDEV + 1.0 / 12, SIGMAS * variance_error);  // NOLINT
+}
+
+/**
+ * exponential:0.5 (ziggurat): mean 2, variance 4, no negative values
+ */
+TEST_P(DistributionEngineTest, ExponentialMoments) {
+    static constexpr double MEAN = 2.0;
+
+    // fourth central moment of the exponential distribution: 9 / lambda^4
+    const double mean_error     = MEAN / std::sqrt(static_cast<double>(SAMPLES));
+    const double variance_error = std::sqrt((9.0 - 1.0) * std::pow(MEAN, 4) / static_cast<double>(SAMPLES));  // NOLINT
+
+    const auto values64 = sample<double>("exponential:0.5", "f64", GetParam());
+    for (const auto value : values64)
+        ASSERT_GE(value, 0.0);
+    const auto [mean64, variance64] = moments(values64);
+    EXPECT_NEAR(mean64, MEAN, SIGMAS * mean_error);
+    EXPECT_NEAR(variance64, MEAN * MEAN, SIGMAS * variance_error);
+
+    const auto values32 = sample<float>("exponential:0.5", "f32", GetParam());
+    for (const auto value : values32)
+        ASSERT_GE(value, 0.0F);
+    const auto [mean32, variance32] = moments(values32);
+    EXPECT_NEAR(mean32, MEAN, SIGMAS * mean_error);
+    EXPECT_NEAR(variance32, MEAN * MEAN, SIGMAS * variance_error);
+}
+
+/**
+ * discrete:1=1,2=2,7=5,-4=0.5 (alias table): only the given values, with the frequencies of the weights
+ */
+TEST_P(DistributionEngineTest, DiscreteFrequencies) {
+    const std::map<std::int64_t, double> weights {{1, 1.0}, {2, 2.0}, {7, 5.0}, {-4, 0.5}};  // NOLINT
+    double                               total = 0.0;
+    for (const auto &[value, weight] : weights)
+        total += weight;
+
+    std::map<std::int64_t, double> expected;
+    for (const auto &[value, weight] : weights)
+        expected[value] = static_cast<double>(SAMPLES) * weight / total;
+
+    std::map<std::int64_t, std::size_t> counts;
+    for (const auto value : sample<std::int16_t>("discrete:1=1,2=2,7=5,-4=0.5", "i16", GetParam())) {
+        ASSERT_TRUE(weights.count(value)) << "value " << value;
+        ++counts[value];
+    }
+
+    // 3 degrees of freedom, p < 1e-8
+    EXPECT_LT(chi2(counts, expected), 45.0);  // NOLINT
+}
+
+/**
+ * with a fixed seed, the elements do not depend on the number of threads or the store type
+ */
+TEST_P(DistributionEngineTest, IdenticalAcrossThreadCounts) {
+    static constexpr std::size_t   SIZE = 3 * ParallelFill::STREAM_BLOCK_SIZE + 12344;
+    static constexpr std::uint64_t SEED = 0x5eed;
+
+    const std::vector<std::pair<std::string, std::string>> distributions {
+            {"normal:0,1", "f32"}, {"exponential:2", "f64"}, {"uniform:-5,1000", "i16"}, {"discrete:1=1,9=3", "u8"}};
+
+    for (const auto &[spec, type] : distributions) {
+        const std::shared_ptr<const Distribution> distribution = make_distribution(spec, type);
+        const LaneMask                            mask(~std::uint64_t {0}, distribution->element_size());
+
+        std::vector<std::uint8_t> reference(SIZE);
+        {
+            ParallelFill filler(GetParam(), 1, 0);
+            filler.set_seed(SEED);
+            filler.set_distribution(distribution);
+            filler.fill(reference.data(), SIZE, mask);
+        }
+
+        for (const auto threads : {2U, 3U, 4U, 7U}) {
+            for (const auto store : {ParallelFill::store_t::CACHED, ParallelFill::store_t::STREAM}) {
+                ParallelFill filler(GetParam(), threads, threads);
+                filler.set_seed(SEED);
+                filler.set_store(store);
+                filler.set_distribution(distribution);
+
+                std::vector<std::uint8_t> data(SIZE);
+                filler.fill(data.data(), SIZE, mask);
+                EXPECT_EQ(data, reference) << spec << ' ' << type << ", " << threads << " threads, "
+                                           << (store == ParallelFill::store_t::STREAM ? "stream" : "cached");
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllEngines,
+                         DistributionEngineTest,
+                         ::testing::ValuesIn(engine_names()),
+                         [](const ::testing::TestParamInfo<std::string> &param_info) { return param_info.param; });
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "engine.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class EngineTest : public ::testing::TestWithParam<std::string> {};
+
+TEST_P(EngineTest, SameSeedSameSequence) {
+    const auto a = make_engine(GetParam(), 42);  // NOLINT
+    const auto b = make_engine(GetParam(), 42);  // NOLINT
+    for (int i = 0; i < 1000; ++i)               // NOLINT
+        ASSERT_EQ((*a)(), (*b)());
+}
+
+TEST_P(EngineTest, DifferentSeedDifferentSequence) {
+    const auto a = make_engine(GetParam(), 1);
+    const auto b = make_engine(GetParam(), 2);
+
+    int equal = 0;
+    for (int i = 0; i < 1000; ++i)  // NOLINT
+        if ((*a)() == (*b)()) ++equal;
+    EXPECT_LT(equal, 2);
+}
+
+TEST_P(EngineTest, ReseedRestartsSequence) {
+    const auto engine = make_engine(GetParam(), 7);  // NOLINT
+
+    std::vector<std::uint64_t> first(100);  // NOLINT
+    for (auto &value : first)
+        value = (*engine)();
+
+    engine->seed(7);  // NOLINT
+    for (const auto value : first)
+        ASSERT_EQ((*engine)(), value);
+}
+
+TEST_P(EngineTest, FillAppliesMask) {
+    static constexpr std::uint64_t MASK = 0x00ff00ff0f0f3c3c;
+
+    const auto                 engine = make_engine(GetParam(), 3);
+    std::vector<std::uint64_t> words(1027);  // NOLINT
+    engine->fill(words.data(), words.size(), MASK);
+
+    std::uint64_t any = 0;
+    for (const auto word : words) {
+        ASSERT_EQ(word & ~MASK, 0U);
+        any |= word;
+    }
+    EXPECT_EQ(any, MASK);
+}
+
+/**
+ * every bit of the generated values is set with probability 1/2 (5 sigma bound)
+ */
+TEST_P(EngineTest, BitBalance) {
+    static constexpr std::size_t SAMPLES = 1 << 16;
+
+    const auto                  engine = make_engine(GetParam(), 12345);  // NOLINT
+    std::array<std::size_t, 64> ones {};
+    for (std::size_t i = 0; i < SAMPLES; ++i) {
+        const auto value = (*engine)();
+        for (std::size_t bit = 0; bit < ones.size(); ++bit)
+            ones[bit] += (value >> bit) & 1U;
+    }
+
+    const double limit = 5.0 * std::sqrt(static_cast<double>(SAMPLES)) / 2.0;  // NOLINT
+    for (std::size_t bit = 0; bit < ones.size(); ++bit) {
+        const auto deviation = std::abs(static_cast<double>(ones[bit]) - static_cast<double>(SAMPLES) / 2.0);
+        EXPECT_LT(deviation, limit) << "bit " << bit;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllEngines,
+                         EngineTest,
+                         ::testing::ValuesIn(engine_names()),
+                         [](const ::testing::TestParamInfo<std::string> &param_info) { return param_info.param; });
+
+TEST(EngineFactory, UnknownEngine) {
+    EXPECT_THROW(static_cast<void>(make_engine("unknown", 0)), std::invalid_argument);
+}
+
+TEST(EngineFactory, EngineName) {
+    for (const auto &name : engine_names())
+        EXPECT_EQ(make_engine(name, 0)->get_name(), name);
+}
@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "engine.hpp"
+#include "fill.hpp"
+#include "parallel_fill.hpp"
+#include "stream.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+//* value of the bytes that must not be written
+static constexpr std::uint8_t GUARD = 0xa5;
+
+//* size of the guard areas before and after the filled memory area
+static constexpr std::size_t GUARD_SIZE = 256;
+
+//* element bitmask of the mask tests (only the lower alignment * 8 bits are used)
+static constexpr std::uint64_t TEST_MASK = 0x3c0f00ff5a01f7e3;
+
+static const char *store_name(ParallelFill::store_t store) {
+    return store == ParallelFill::store_t::STREAM ? "stream" : "cached";
+}
+
+//* printer of GoogleTest for test parameters
+static void PrintTo(ParallelFill::store_t store, std::ostream *o) {  // NOLINT
+    *o << store_name(store);
+}
+
+/**
+ * \brief memory area with guard bytes around it
+ */
+class GuardedBuffer {
+private:
+    std::vector<std::uint8_t> bytes;
+    std::size_t               size;
+    std::size_t               offset;
+
+public:
+    /**
+     * @param size size of the memory area in bytes
+     * @param misalignment offset of the memory area relative to a 64 byte boundary
+     */
+    GuardedBuffer(std::size_t size, std::size_t misalignment)
+        : bytes(size + 2 * GUARD_SIZE + 2 * ParallelFill::CACHE_LINE_SIZE + misalignment, GUARD), size(size) {
+        const auto addr = reinterpret_cast<std::uintptr_t>(bytes.data());  // NOLINT
+        const auto pad  = (ParallelFill::CACHE_LINE_SIZE - addr % ParallelFill::CACHE_LINE_SIZE) %
+                         ParallelFill::CACHE_LINE_SIZE;
+        offset = pad + GUARD_SIZE + misalignment;
+    }
+
+    [[nodiscard]] std::uint8_t *data() noexcept { return bytes.data() + offset; }
+
+    [[nodiscard]] const std::uint8_t *data() const noexcept { return bytes.data() + offset; }
+
+    /**
+     * \brief check that no byte outside of the memory area was written
+     */
+    [[nodiscard]] bool guards_intact() const noexcept {
+        const auto is_guard = [](std::uint8_t byte) { return byte == GUARD; };
+        return std::all_of(bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(offset), is_guard) &&
+               std::all_of(bytes.begin() + static_cast<std::ptrdiff_t>(offset + size), bytes.end(), is_guard);
+    }
+};
+
+/**
+ * \brief read an element in native endianness
+ */
+static std::uint64_t element(const std::uint8_t *data, std::size_t alignment) {
+    std::uint64_t value = 0;
+    switch (alignment) {
+        case 1: value = data[0]; break;
+        case 2: {
+            std::uint16_t tmp = 0;
+            std::memcpy(&tmp, data, sizeof(tmp));
+            value = tmp;
+            break;
+        }
+        case 4: {  // NOLINT
+            std::uint32_t tmp = 0;
+            std::memcpy(&tmp, data, sizeof(tmp));
+            value = tmp;
+            break;
+        }
+        default: std::memcpy(&value, data, sizeof(value)); break;
+    }
+    return value;
+}
+
+/**
+ * \brief element bitmask of an alignment
+ */
+static std::uint64_t element_mask(std::uint64_t mask, std::size_t alignment) {
+    return alignment == sizeof(std::uint64_t) ? mask : mask & ((std::uint64_t {1} << (alignment * 8)) - 1);  // NOLINT
+}
+
+// ---------------------------------------- mask compliance ------------------------------------------------------------
+
+using mask_param_t = std::tuple<std::string, std::size_t, ParallelFill::store_t>;
+
+class FillMaskTest : public ::testing::TestWithParam<mask_param_t> {};
+
+static std::string mask_test_name(const ::testing::TestParamInfo<mask_param_t> &param_info) {
+    const auto &[engine, alignment, store] = param_info.param;
+    return engine + "_a" + std::to_string(alignment) + '_' + store_name(store);
+}
+
+/**
+ * every element contains only bits of the mask, and every bit of the mask is set in at least one element
+ */
+TEST_P(FillMaskTest, MaskCompliance) {
+    const auto &[engine, alignment, store] = GetParam();
+
+    static constexpr std::size_t ELEMENTS = 40000;
+    const auto                   size     = ELEMENTS * alignment;
+    const auto                   mask     = element_mask(TEST_MASK, alignment);
+
+    // odd thread count and unaligned start: head, tail and chunk boundaries are not cache line aligned
+    ParallelFill filler(engine, 3, 1);
+    filler.set_store(store);
+
+    GuardedBuffer buffer(size, 3);
+    filler.fill(buffer.data(), size, LaneMask(TEST_MASK, alignment));
+    ASSERT_TRUE(buffer.guards_intact());
+
+    std::uint64_t any = 0;
+    for (std::size_t i = 0; i < ELEMENTS; ++i) {
+        const auto value = element(buffer.data() + i * alignment, alignment);
+        ASSERT_EQ(value & ~mask, 0U) << "element " << i;
+        any |= value;
+    }
+    EXPECT_EQ(any, mask);
+}
+
+/**
+ * single threaded fill functions (without ParallelFill)
+ */
+TEST_P(FillMaskTest, FillFunctions) {
+    const auto &[engine_name, alignment, store] = GetParam();
+
+    static constexpr std::size_t ELEMENTS = 10000;
+    const auto                   size     = ELEMENTS * alignment;
+    const auto                   mask     = element_mask(TEST_MASK, alignment);
+    const auto                   engine   = make_engine(engine_name, 5);  // NOLINT
+
+    GuardedBuffer buffer(size, 5);  // NOLINT
+    if (store == ParallelFill::store_t::STREAM) {
+        fill_random_stream(buffer.data(), size, LaneMask(TEST_MASK, alignment), *engine);
+        stream_fence();
+    } else {
+        fill_random(buffer.data(), size, LaneMask(TEST_MASK, alignment), *engine);
+    }
+    ASSERT_TRUE(buffer.guards_intact());
+
+    for (std::size_t i = 0; i < ELEMENTS; ++i)
+        ASSERT_EQ(element(buffer.data() + i * alignment, alignment) & ~mask, 0U) << "element " << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(AllKernels,
+                         FillMaskTest,
+                         ::testing::Combine(::testing::ValuesIn(engine_names()),
+                                            ::testing::Values(1, 2, 4, 8),
+                                            ::testing::Values(ParallelFill::store_t::CACHED,
+                                                              ParallelFill::store_t::STREAM)),
+                         mask_test_name);
+
+// ---------------------------------------- bounds ---------------------------------------------------------------------
+
+using bounds_param_t = std::tuple<std::string, ParallelFill::store_t>;
+
+class FillBoundsTest : public ::testing::TestWithParam<bounds_param_t> {};
+
+static std::string bounds_test_name(const ::testing::TestParamInfo<bounds_param_t> &param_info) {
+    const auto &[engine, store] = param_info.param;
+    return engine + '_' + store_name(store);
+}
+
+/**
+ * only [offset, offset + elements * alignment) is written (see --offset and --elements)
+ */
+TEST_P(FillBoundsTest, OffsetElements) {
+    const auto &[engine, store] = GetParam();
+
+    ParallelFill filler(engine, 4, 1);
+    filler.set_store(store);
+
+    static constexpr std::array<std::size_t, 6> OFFSETS {0, 1, 7, 63, 64, 4097};
+    static constexpr std::array<std::size_t, 7> ELEMENTS {1, 3, 8, 63, 64, 1000, 70001};
+
+    for (const auto alignment : {1U, 2U, 4U, 8U}) {
+        for (const auto offset : OFFSETS) {
+            for (const auto elements : ELEMENTS) {
+                const auto    size = elements * alignment;
+                GuardedBuffer buffer(size, offset);
+                filler.fill(buffer.data(), size, LaneMask(~std::uint64_t {0}, alignment));
+                ASSERT_TRUE(buffer.guards_intact())
+                        << "alignment " << alignment << ", offset " << offset << ", elements " << elements;
+            }
+        }
+    }
+}
+
+/**
+ * fill_ranges writes only the given ranges
+ */
+TEST_P(FillBoundsTest, Ranges) {
+    const auto &[engine, store] = GetParam();
+
+    ParallelFill filler(engine, 3, 1);
+    filler.set_store(store);
+
+    static constexpr std::size_t               SIZE = 1 << 20;
+    const std::vector<ParallelFill::range_t> ranges {{0, 64}, {100, 1}, {4096, 65536}, {SIZE - 129, 129}};  // NOLINT
+
+    std::vector<std::uint8_t> data(SIZE, GUARD);
+    filler.fill_ranges(data.data(), ranges, LaneMask(~std::uint64_t {0}, 1));
+
+    std::vector<bool> inside(SIZE, false);
+    for (const auto &[offset, length] : ranges)
+        std::fill_n(inside.begin() + static_cast<std::ptrdiff_t>(offset), length, true);
+
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        if (!inside[i]) { ASSERT_EQ(data[i], GUARD) << "byte " << i; }
+    }
+}
+
+/**
+ * copy writes exactly the destination
+ */
+TEST_P(FillBoundsTest, Copy) {
+    const auto &[engine, store] = GetParam();
+
+    ParallelFill filler(engine, 3, 1);
+    filler.set_store(store);
+
+    static constexpr std::size_t SIZE = 300001;
+    std::vector<std::uint8_t>    src(SIZE);
+    filler.fill(src.data(), src.size(), LaneMask(~std::uint64_t {0}, 1));
+
+    GuardedBuffer buffer(SIZE, 9);  // NOLINT
+    filler.copy(buffer.data(), src.data(), SIZE);
+    ASSERT_TRUE(buffer.guards_intact());
+    EXPECT_EQ(std::memcmp(buffer.data(), src.data(), SIZE), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllEngines,
+                         FillBoundsTest,
+                         ::testing::Combine(::testing::ValuesIn(engine_names()),
+                                            ::testing::Values(ParallelFill::store_t::CACHED,
+                                                              ParallelFill::store_t::STREAM)),
+                         bounds_test_name);
+
+// ---------------------------------------- reproducibility and statistics ---------------------------------------------
+
+class FillEngineTest : public ::testing::TestWithParam<std::string> {};
+
+/**
+ * with a fixed seed, the output does not depend on the number of threads or the store type
+ */
+TEST_P(FillEngineTest, IdenticalAcrossThreadCounts) {
+    static constexpr std::size_t   SIZE = 3 * ParallelFill::STREAM_BLOCK_SIZE + 12345;
+    static constexpr std::uint64_t SEED = 0x5eed;
+
+    const LaneMask            mask(TEST_MASK, 2);
+    std::vector<std::uint8_t> reference(SIZE);
+    {
+        ParallelFill filler(GetParam(), 1, 0);
+        filler.set_seed(SEED);
+        filler.fill(reference.data(), SIZE, mask);
+    }
+
+    for (const auto threads : {2U, 3U, 4U, 7U}) {
+        for (const auto store : {ParallelFill::store_t::CACHED, ParallelFill::store_t::STREAM}) {
+            ParallelFill filler(GetParam(), threads, threads);
+            filler.set_seed(SEED);
+            filler.set_store(store);
+
+            std::vector<std::uint8_t> data(SIZE);
+            filler.fill(data.data(), SIZE, mask);
+            EXPECT_EQ(data, reference) << threads << " threads, " << store_name(store);
+        }
+    }
+}
+
+/**
+ * different generations and streams produce different data
+ */
+TEST_P(FillEngineTest, GenerationsDiffer) {
+    static constexpr std::size_t SIZE = 4096;
+
+    ParallelFill filler(GetParam(), 2, 0);
+    filler.set_seed(1);
+
+    const LaneMask            mask(~std::uint64_t {0}, 1);
+    std::vector<std::uint8_t> a(SIZE);
+    std::vector<std::uint8_t> b(SIZE);
+    std::vector<std::uint8_t> c(SIZE);
+    filler.fill(a.data(), SIZE, mask);
+    filler.set_generation(1);
+    filler.fill(b.data(), SIZE, mask);
+    filler.fill(c.data(), SIZE, mask, 1);
+
+    EXPECT_NE(a, b);
+    EXPECT_NE(b, c);
+}
+
+/**
+ * chi-squared test of the byte distribution (255 degrees of freedom, p < 1e-8 for a uniform distribution)
+ */
+TEST_P(FillEngineTest, ByteDistribution) {
+    static constexpr std::size_t SIZE  = 1 << 20;
+    static constexpr double      LIMIT = 400.0;
+
+    ParallelFill filler(GetParam(), 4, 99);  // NOLINT
+
+    std::vector<std::uint8_t> data(SIZE);
+    filler.fill(data.data(), SIZE, LaneMask(~std::uint64_t {0}, 1));
+
+    std::array<std::size_t, 256> histogram {};
+    for (const auto byte : data)
+        ++histogram[byte];
+
+    const double expected = static_cast<double>(SIZE) / static_cast<double>(histogram.size());
+    double       chi2     = 0.0;
+    for (const auto count : histogram) {
+        const auto diff = static_cast<double>(count) - expected;
+        chi2 += diff * diff / expected;
+    }
+    EXPECT_LT(chi2, LIMIT);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllEngines,
+                         FillEngineTest,
+                         ::testing::ValuesIn(engine_names()),
+                         [](const ::testing::TestParamInfo<std::string> &param_info) { return param_info.param; });
+
+TEST(LaneMask, FullMask) {
+    for (const auto alignment : {1U, 2U, 4U, 8U}) {
+        EXPECT_TRUE(LaneMask(~std::uint64_t {0}, alignment).is_full());
+        EXPECT_FALSE(LaneMask(TEST_MASK, alignment).is_full());
+    }
+}